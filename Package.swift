@@ -171,6 +171,12 @@ extension Array where Element == PackageDescription.CXXSetting {
       .define("SWT_NO_PIPES", .when(platforms: [.wasi])),
     ]
 
+    // Allocation tracking interposes the system allocator for the whole
+    // process, so it is only enabled on request.
+    if Context.environment["SWT_ENABLE_ALLOCATION_TRACKING"] != nil {
+      result.append(.define("SWT_ENABLE_ALLOCATION_TRACKING"))
+    }
+
     // Capture the testing library's version as a C++ string constant.
     if let git = Context.gitInformation {
       let testingLibraryVersion = if let tag = git.currentTag {
@@ -65,6 +65,109 @@ extension ABIv0 {
   unsafeBitCast(ABIv0.entryPoint, to: UnsafeRawPointer.self)
 }
 
+#if !SWT_NO_FILE_IO && (SWT_TARGET_OS_APPLE || os(Linux) || os(FreeBSD) || os(Android))
+// MARK: - Shared-memory ring buffer transport
+
+extension ABIv0 {
+  /// The type of an alternative entry point to the testing library that
+  /// writes records to a shared-memory ring buffer instead of calling a record
+  /// handler.
+  ///
+  /// - Parameters:
+  ///   - configurationJSON: A buffer to memory representing the test
+  ///     configuration and options. If `nil`, a new instance is synthesized
+  ///     from the command-line arguments to the current process.
+  ///   - ringBuffer: The memory of the ring buffer to write records to. This
+  ///     memory starts with an instance of `SWTRingBufferHeader` and must
+  ///     remain valid until this function returns.
+  ///   - notificationFD: A file descriptor to which the testing library writes
+  ///     an 8-byte integer whenever `ringBuffer` stops being empty, or `-1` if
+  ///     the caller polls `ringBuffer` instead.
+  ///
+  /// - Returns: Whether or not the test run finished successfully.
+  ///
+  /// - Throws: Any error that occurred prior to running tests. Errors that are
+  ///   thrown while tests are running are handled by the testing library.
+  public typealias RingBufferEntryPoint = @convention(thin) @Sendable (
+    _ configurationJSON: UnsafeRawBufferPointer?,
+    _ ringBuffer: UnsafeMutableRawBufferPointer,
+    _ notificationFD: CInt
+  ) async throws -> Bool
+
+  /// An alternative entry point to the testing library that writes records to
+  /// a shared-memory ring buffer.
+  ///
+  /// The value of this property is accessible from C and C++ as a function
+  /// with name `"swt_abiv0_getRingBufferEntryPoint"` and can be dynamically
+  /// looked up at runtime using `dlsym()` or a platform equivalent.
+  ///
+  /// Unlike ``entryPoint-swift.type.property``, which calls its record handler
+  /// synchronously from the thread that produced each record, this entry point
+  /// copies each record into the ring buffer and only waits if the ring buffer
+  /// is full. The caller reads records from the ring buffer on a thread (or in
+  /// a process) of its choosing, so slow processing of records does not slow
+  /// down tests until the ring buffer fills. Each record is a JSON object as
+  /// described in `ABI/JSON.md`; for the framing of records in the ring buffer,
+  /// see `SWTRingBufferHeader`.
+  public static var ringBufferEntryPoint: RingBufferEntryPoint {
+    return { configurationJSON, ringBuffer, notificationFD in
+      let ringBuffer = _RingBuffer(ringBuffer, notificationFD: notificationFD)
+      return try await Testing.entryPoint(configurationJSON: configurationJSON) { recordJSON in
+        ringBuffer.write(recordJSON)
+      } == EXIT_SUCCESS
+    }
+  }
+}
+
+@_cdecl("swt_abiv0_getRingBufferEntryPoint")
+@usableFromInline func abiv0_getRingBufferEntryPoint() -> UnsafeRawPointer {
+  unsafeBitCast(ABIv0.ringBufferEntryPoint, to: UnsafeRawPointer.self)
+}
+
+/// A type representing a shared-memory ring buffer that records are written
+/// to.
+private struct _RingBuffer: Sendable {
+  /// The memory of the ring buffer.
+  private nonisolated(unsafe) let _buffer: UnsafeMutableRawBufferPointer
+
+  /// The file descriptor to notify when the ring buffer stops being empty.
+  private let _notificationFD: CInt
+
+  /// A lock used to serialize writes.
+  ///
+  /// The ring buffer supports a single writer, but records are produced by
+  /// many threads concurrently.
+  private let _lock = Locked(rawValue: ())
+
+  init(_ buffer: UnsafeMutableRawBufferPointer, notificationFD: CInt) {
+    _buffer = buffer
+    _notificationFD = notificationFD
+  }
+
+  /// Write a record to the ring buffer.
+  ///
+  /// - Parameters:
+  ///   - recordJSON: The record to write.
+  ///
+  /// If the ring buffer is full, this function waits for the reader to free
+  /// space. If the record is too large to fit in the ring buffer, if the
+  /// reader has closed the ring buffer, or if the reader does not free space
+  /// in time, it is dropped. Once a write has timed out, later records are
+  /// dropped without waiting until the reader makes progress. (For more
+  /// information, see `swt_ringBufferWrite()`.) Because writes are serialized,
+  /// this bounds how long a stalled reader can block other threads that
+  /// produce records.
+  func write(_ recordJSON: UnsafeRawBufferPointer) {
+    guard let baseAddress = _buffer.baseAddress, let recordAddress = recordJSON.baseAddress else {
+      return
+    }
+    _lock.withLock { _ in
+      _ = swt_ringBufferWrite(baseAddress, _buffer.count, _notificationFD, recordAddress, recordJSON.count)
+    }
+  }
+}
+#endif
+
 #if !SWT_NO_SNAPSHOT_TYPES
 // MARK: - Xcode 16 Beta 1 compatibility
 
@@ -34,25 +34,68 @@ func entryPoint(passing args: __CommandLineArguments_v0?, eventHandler: Event.Ha
       }
 #endif
 
+    // Measure how long each phase of startup takes so that regressions can be
+    // attributed to a specific phase.
+    var startupProfile = StartupProfile()
+
+    let argumentParsingStartInstant = Test.Clock.Instant.now
     let args = try args ?? parseCommandLineArguments(from: CommandLine.arguments)
+    startupProfile.add(Int(argumentParsingStartInstant.nanoseconds(until: .now)), to: .argumentParsing)
+
+    // If a server socket was specified, serve test runs instead of running
+    // tests once. `runTestServer` only returns if an error occurs.
+    if let serverSocketPath = args.serverSocketPath {
+#if canImport(Foundation) && !SWT_NO_FILE_IO && (SWT_TARGET_OS_APPLE || os(Linux) || os(FreeBSD) || os(Android))
+      try await runTestServer(listeningAt: serverSocketPath)
+#else
+      throw _EntryPointError.featureUnavailable("The `--experimental-server-socket-path' option is not supported on this platform.")
+#endif
+    }
     // Configure the test runner.
-    var configuration = try configurationForEntryPoint(from: args)
+    var configuration = try await startupProfile.measure(.configuration) {
+      try configurationForEntryPoint(from: args)
+    }
 
-    // Set up the event handler.
+    // Set up the event handler. If failed test cases are retried, a test case
+    // that records an issue only causes the run to fail if it does not pass
+    // when retried.
+    let isRetryingFailedTestCases = configuration.retryPolicy != nil
+    let unresolvedTestCases = Locked(rawValue: Set<_TestCaseKey>())
     configuration.eventHandler = { [oldEventHandler = configuration.eventHandler] event, context in
-      if case let .issueRecorded(issue) = event.kind, !issue.isKnown {
-        exitCode.withLock { exitCode in
-          exitCode = EXIT_FAILURE
+      switch event.kind {
+      case let .issueRecorded(issue) where !issue.isKnown:
+        if isRetryingFailedTestCases, let testID = event.testID, let testCaseID = event.testCaseID {
+          unresolvedTestCases.withLock { unresolvedTestCases in
+            _ = unresolvedTestCases.insert(_TestCaseKey(testID: testID, testCaseID: testCaseID))
+          }
+        } else {
+          exitCode.withLock { exitCode in
+            exitCode = EXIT_FAILURE
+          }
+        }
+      case let .testCaseRetried(result):
+        if result.verdict == .flaky, let testID = event.testID, let testCaseID = event.testCaseID {
+          unresolvedTestCases.withLock { unresolvedTestCases in
+            _ = unresolvedTestCases.remove(_TestCaseKey(testID: testID, testCaseID: testCaseID))
+          }
         }
+      default:
+        break
       }
       oldEventHandler(event, context)
     }
     configuration.verbosity = args.verbosity
 
+    // Test case argument IDs only need to be human-readable if a tool will see
+    // them via the event stream or the ABI entry point's event handler.
+    configuration.usesHumanReadableTestCaseArgumentIDs = eventHandler != nil || args.eventStreamOutputPath != nil
+
 #if !SWT_NO_FILE_IO
     // Configure the event recorder to write events to stderr.
     if configuration.verbosity > .min {
-      let eventRecorder = Event.ConsoleOutputRecorder(options: .for(.stderr)) { string in
+      var options = Event.ConsoleOutputRecorder.Options.for(.stderr)
+      options.showsLiveProgress = args.liveProgress ?? false
+      let eventRecorder = Event.ConsoleOutputRecorder(options: options) { string in
         try? FileHandle.stderr.write(string)
       }
       configuration.eventHandler = { [oldEventHandler = configuration.eventHandler] event, context in
@@ -75,7 +118,10 @@ func entryPoint(passing args: __CommandLineArguments_v0?, eventHandler: Event.Ha
     let tests: [Test]
 
     if args.listTests ?? false {
-      tests = await Array(Test.all)
+      tests = await startupProfile.measure(.discovery) {
+        await Array(Test.all)
+      }
+      Event.post(.startupMeasured(startupProfile), for: (nil, nil), configuration: configuration)
 
       if args.verbosity > .min {
         for testID in listTestsForEntryPoint(tests, verbosity: args.verbosity) {
@@ -94,10 +140,38 @@ func entryPoint(passing args: __CommandLineArguments_v0?, eventHandler: Event.Ha
         Event.post(.testDiscovered, for: (test, nil), configuration: configuration)
       }
     } else {
-      // Run the tests.
-      let runner = await Runner(configuration: configuration)
+      // Discover and plan the tests, then run them.
+      let allTests = await startupProfile.measure(.discovery) {
+        await Array(Test.all)
+      }
+      let lockedStartupProfile = Locked(rawValue: startupProfile)
+      let plan = await Runner.Plan(tests: allTests, configuration: configuration, startupProfile: lockedStartupProfile)
+      Event.post(.startupMeasured(lockedStartupProfile.rawValue), for: (nil, nil), configuration: configuration)
+
+      let runner = Runner(plan: plan, configuration: configuration)
       tests = runner.tests
       await runner.run()
+
+#if !SWT_NO_FILE_IO
+      // If performance baselines were updated during the run, save them.
+      if let performanceBaselines = configuration.performanceBaselines, performanceBaselines.isUpdating,
+         let performanceBaselinesPath = args.performanceBaselinesPath {
+        try performanceBaselines.write(toFileAtPath: performanceBaselinesPath)
+      }
+
+      // If lock statistics were recorded during the run, report them.
+      if let lockStatistics = LockStatistics.summary {
+        try? FileHandle.stderr.write(lockStatistics)
+      }
+#endif
+    }
+
+    // If any test case that recorded an issue did not pass when retried, the
+    // run failed.
+    if !unresolvedTestCases.rawValue.isEmpty {
+      exitCode.withLock { exitCode in
+        exitCode = EXIT_FAILURE
+      }
     }
 
     // If there were no matching tests, exit with a dedicated exit code so that
@@ -123,6 +197,16 @@ func entryPoint(passing args: __CommandLineArguments_v0?, eventHandler: Event.Ha
   return exitCode.rawValue
 }
 
+/// A type identifying a test case that recorded an issue during a test run
+/// started by ``entryPoint(passing:eventHandler:)``.
+private struct _TestCaseKey: Hashable {
+  /// The ID of the test.
+  var testID: Test.ID
+
+  /// The ID of the test case.
+  var testCaseID: Test.Case.ID
+}
+
 // MARK: - Listing tests
 
 /// List all of the given tests in the "specifier" format used by Swift Package
@@ -203,6 +287,13 @@ public struct __CommandLineArguments_v0: Sendable {
   /// The value of the `--quiet` argument.
   public var quiet: Bool?
 
+  /// The value of the `--live-progress` argument.
+  ///
+  /// If the value of this property is `true`, console output is summarized on
+  /// a single, periodically-updated status line, and only recorded issues and
+  /// the final summary are written in full.
+  public var liveProgress: Bool?
+
   /// Storage for the ``verbosity`` property.
   private var _verbosity: Int?
 
@@ -275,6 +366,71 @@ public struct __CommandLineArguments_v0: Sendable {
 
   /// The value of the `--repeat-until` argument.
   public var repeatUntil: String?
+
+  /// The value of the `--performance-baselines` argument.
+  ///
+  /// If the value of this property is not `nil`, the duration of each test
+  /// case is compared against the baselines stored in the file at this path,
+  /// or added to them if ``updatePerformanceBaselines`` is `true`.
+  public var performanceBaselinesPath: String?
+
+  /// The value of the `--update-performance-baselines` argument.
+  public var updatePerformanceBaselines: Bool?
+
+  /// The value of the `--performance-regression-test` argument.
+  ///
+  /// Supported values are `"mad"` (the default) and `"zscore"`.
+  public var performanceRegressionTest: String?
+
+  /// The value of the `--performance-regression-threshold` argument.
+  public var performanceRegressionThreshold: Double?
+
+  /// The value of the `--performance-counters` argument.
+  ///
+  /// If the value of this property is `true`, test cases are run serially and
+  /// their performance counters are measured. For more information, see
+  /// ``Configuration/measurePerformanceCounters``.
+  public var performanceCounters: Bool?
+
+  /// The value of the `--profile` argument.
+  ///
+  /// If the value of this property is not `nil`, test cases are run serially
+  /// and their call stacks are sampled, then written to this path in the
+  /// "folded" format used to generate flame graphs. For more information, see
+  /// ``Configuration/profileTestCases``.
+  public var profileOutputPath: String?
+
+  /// The value of the `--experimental-flake-hunt` argument.
+  ///
+  /// If the value of this property is not `nil`, each selected test case is
+  /// run up to this many times, concurrently, to find intermittent failures.
+  /// For more information, see ``FlakeHuntingPolicy``.
+  public var flakeHuntAttempts: Int?
+
+  /// The value of the `--experimental-flake-hunt-threshold` argument.
+  ///
+  /// If the value of this property is not `nil`, test cases continue to be
+  /// attempted after they fail, until the confidence interval of their failure
+  /// rate lies entirely above or below this value.
+  public var flakeHuntThreshold: Double?
+
+  /// The value of the `--retry-failed` argument.
+  ///
+  /// If the value of this property is not `nil`, test cases that fail are run
+  /// again, one at a time, up to this many times after all other tests have
+  /// run. For more information, see ``Configuration/RetryPolicy``.
+  public var retryFailed: Int?
+
+  /// The value of the `--retry-failed-in-new-process` argument.
+  public var retryFailedInNewProcess: Bool?
+
+  /// The value of the `--experimental-server-socket-path` argument.
+  ///
+  /// If the value of this property is not `nil`, the testing library runs as a
+  /// persistent test server listening on a Unix domain socket at this path
+  /// instead of running tests once. For more information, see
+  /// ``runTestServer(listeningAt:)``.
+  public var serverSocketPath: String?
 }
 
 extension __CommandLineArguments_v0: Codable {
@@ -287,6 +443,7 @@ extension __CommandLineArguments_v0: Codable {
     case verbose
     case veryVerbose
     case quiet
+    case liveProgress
     case _verbosity = "verbosity"
     case xunitOutput
     case eventStreamOutputPath
@@ -295,6 +452,17 @@ extension __CommandLineArguments_v0: Codable {
     case skip
     case repetitions
     case repeatUntil
+    case performanceBaselinesPath
+    case updatePerformanceBaselines
+    case performanceRegressionTest
+    case performanceRegressionThreshold
+    case performanceCounters
+    case profileOutputPath
+    case flakeHuntAttempts
+    case flakeHuntThreshold
+    case retryFailed
+    case retryFailedInNewProcess
+    case serverSocketPath
   }
 }
 
@@ -349,6 +517,12 @@ func parseCommandLineArguments(from args: [String]) throws -> __CommandLineArgum
      !isLastArgument(at: eventOutputVersionIndex) {
     result.eventStreamVersion = Int(args[args.index(after: eventOutputVersionIndex)])
   }
+
+  // Persistent test server (experimental)
+  if let serverSocketPathIndex = args.firstIndex(of: "--experimental-server-socket-path"),
+     !isLastArgument(at: serverSocketPathIndex) {
+    result.serverSocketPath = args[args.index(after: serverSocketPathIndex)]
+  }
 #endif
 
   // XML output
@@ -389,6 +563,9 @@ func parseCommandLineArguments(from args: [String]) throws -> __CommandLineArgum
   if args.contains("--quiet") || args.contains("-q") {
     result.quiet = true
   }
+  if args.contains("--live-progress") {
+    result.liveProgress = true
+  }
 
   // Filtering
   func filterValues(forArgumentsWithLabel label: String) -> [String] {
@@ -413,6 +590,46 @@ func parseCommandLineArguments(from args: [String]) throws -> __CommandLineArgum
     result.repeatUntil = args[args.index(after: repeatUntilIndex)]
   }
 
+  // Performance baselines (experimental)
+  if let performanceBaselinesIndex = args.firstIndex(of: "--performance-baselines"), !isLastArgument(at: performanceBaselinesIndex) {
+    result.performanceBaselinesPath = args[args.index(after: performanceBaselinesIndex)]
+  }
+  if args.contains("--update-performance-baselines") {
+    result.updatePerformanceBaselines = true
+  }
+  if let performanceRegressionTestIndex = args.firstIndex(of: "--performance-regression-test"), !isLastArgument(at: performanceRegressionTestIndex) {
+    result.performanceRegressionTest = args[args.index(after: performanceRegressionTestIndex)]
+  }
+  if let performanceRegressionThresholdIndex = args.firstIndex(of: "--performance-regression-threshold"), !isLastArgument(at: performanceRegressionThresholdIndex) {
+    result.performanceRegressionThreshold = Double(args[args.index(after: performanceRegressionThresholdIndex)])
+  }
+
+  // Performance counters (experimental)
+  if args.contains("--performance-counters") {
+    result.performanceCounters = true
+  }
+
+  // Profiling (experimental)
+  if let profileOutputPathIndex = args.firstIndex(of: "--profile"), !isLastArgument(at: profileOutputPathIndex) {
+    result.profileOutputPath = args[args.index(after: profileOutputPathIndex)]
+  }
+
+  // Retrying failed test cases (experimental)
+  if let retryFailedIndex = args.firstIndex(of: "--retry-failed"), !isLastArgument(at: retryFailedIndex) {
+    result.retryFailed = Int(args[args.index(after: retryFailedIndex)])
+  }
+  if args.contains("--retry-failed-in-new-process") {
+    result.retryFailedInNewProcess = true
+  }
+
+  // Flake hunting (experimental)
+  if let flakeHuntIndex = args.firstIndex(of: "--experimental-flake-hunt"), !isLastArgument(at: flakeHuntIndex) {
+    result.flakeHuntAttempts = Int(args[args.index(after: flakeHuntIndex)])
+  }
+  if let flakeHuntThresholdIndex = args.firstIndex(of: "--experimental-flake-hunt-threshold"), !isLastArgument(at: flakeHuntThresholdIndex) {
+    result.flakeHuntThreshold = Double(args[args.index(after: flakeHuntThresholdIndex)])
+  }
+
   return result
 }
 
@@ -453,9 +670,21 @@ public func configurationForEntryPoint(from args: __CommandLineArguments_v0) thr
     // Open the XML file for writing.
     let file = try FileHandle(forWritingAtPath: xunitOutputPath)
 
-    // Set up the XML recorder.
-    let xmlRecorder = Event.JUnitXMLRecorder { string in
-      try? file.write(string)
+    // Set up the XML recorder. If the destination is a regular file, stream
+    // results to it as each test ends and fill in the aggregate counts when
+    // the run ends. Otherwise (for instance, if it is a pipe), results must be
+    // buffered until the run ends. They must also be buffered if failed test
+    // cases are retried because a test's results are not final when it ends.
+    let xmlRecorder = if file.isRegularFile && (args.retryFailed ?? 0) <= 0 {
+      Event.JUnitXMLRecorder { string in
+        try? file.write(string)
+      } rewritingUsing: { string, offset in
+        try? file.write(string, atOffset: Int64(offset))
+      }
+    } else {
+      Event.JUnitXMLRecorder { string in
+        try? file.write(string)
+      }
     }
 
     configuration.eventHandler = { [oldEventHandler = configuration.eventHandler] event, context in
@@ -464,6 +693,61 @@ public func configurationForEntryPoint(from args: __CommandLineArguments_v0) thr
     }
   }
 
+  // Performance baselines (experimental)
+  if let performanceBaselinesPath = args.performanceBaselinesPath {
+    var regressionPolicy = PerformanceBaselines.RegressionPolicy()
+    if let performanceRegressionTest = args.performanceRegressionTest {
+      switch performanceRegressionTest.lowercased() {
+      case "mad":
+        regressionPolicy.statisticalTest = .medianAbsoluteDeviation
+      case "zscore", "z-score":
+        regressionPolicy.statisticalTest = .zScore
+      default:
+        throw _EntryPointError.invalidArgument("--performance-regression-test", value: performanceRegressionTest)
+      }
+    }
+    if let performanceRegressionThreshold = args.performanceRegressionThreshold {
+      regressionPolicy.threshold = performanceRegressionThreshold
+    }
+    configuration.performanceBaselines = try PerformanceBaselines(
+      contentsOfFileAtPath: performanceBaselinesPath,
+      regressionPolicy: regressionPolicy,
+      isUpdating: args.updatePerformanceBaselines ?? false
+    )
+  }
+
+  // Profiling (experimental)
+  if let profileOutputPath = args.profileOutputPath {
+    let file = try FileHandle(forWritingAtPath: profileOutputPath)
+
+    // The profiler samples every thread in the process, so test cases must run
+    // one at a time to be attributed their samples. Samples of the same test's
+    // call stacks are merged across its test cases and written when the run
+    // ends.
+    configuration.isParallelizationEnabled = false
+    configuration.profileTestCases = true
+    let symbolicationMode = configuration.backtraceSymbolicationMode ?? .demangled
+    let foldedStacks = Locked<[String: Int]>(rawValue: [:])
+    configuration.eventHandler = { [oldEventHandler = configuration.eventHandler] event, context in
+      switch event.kind {
+      case let .testCaseProfiled(profile):
+        if let test = context.test {
+          let testFoldedStacks = profile.foldedStacks(under: String(describing: test.id), symbolicationMode: symbolicationMode)
+          foldedStacks.withLock { foldedStacks in
+            foldedStacks.merge(testFoldedStacks, uniquingKeysWith: +)
+          }
+        }
+      case .runEnded:
+        for (stack, count) in foldedStacks.rawValue.sorted(by: { $0.key < $1.key }) {
+          try? file.write("\(stack) \(count)\n")
+        }
+      default:
+        break
+      }
+      oldEventHandler(event, context)
+    }
+  }
+
 #if canImport(Foundation)
   // Event stream output (experimental)
   if let eventStreamOutputPath = args.eventStreamOutputPath {
@@ -482,6 +766,14 @@ public func configurationForEntryPoint(from args: __CommandLineArguments_v0) thr
 #endif
 #endif
 
+  // Performance counters (experimental)
+  if args.performanceCounters == true {
+    // Performance counters measure the thread a test case starts on, so test
+    // cases must run one at a time to avoid counting each other's work.
+    configuration.isParallelizationEnabled = false
+    configuration.measurePerformanceCounters = true
+  }
+
   // Filtering
   var filters = [Configuration.TestFilter]()
   func testFilter(forRegularExpressions regexes: [String]?, label: String, membership: Configuration.TestFilter.Membership) throws -> Configuration.TestFilter {
@@ -525,6 +817,27 @@ public func configurationForEntryPoint(from args: __CommandLineArguments_v0) thr
   }
   configuration.repetitionPolicy = repetitionPolicy
 
+  // Retrying failed test cases (experimental)
+  if let retryFailed = args.retryFailed, retryFailed > 0 {
+    configuration.retryPolicy = Configuration.RetryPolicy(
+      maximumRetryCount: retryFailed,
+      retriesInNewProcess: args.retryFailedInNewProcess ?? false
+    )
+  }
+
+  // Flake hunting (experimental)
+  if let flakeHuntAttempts = args.flakeHuntAttempts, flakeHuntAttempts > 0 {
+    var flakeHuntingPolicy = FlakeHuntingPolicy(maximumAttemptCount: flakeHuntAttempts)
+    if let flakeHuntThreshold = args.flakeHuntThreshold {
+      guard (0 ... 1).contains(flakeHuntThreshold) else {
+        throw _EntryPointError.invalidArgument("--experimental-flake-hunt-threshold", value: "\(flakeHuntThreshold)")
+      }
+      flakeHuntingPolicy.stopsAtFirstFailure = false
+      flakeHuntingPolicy.failureRateThreshold = flakeHuntThreshold
+    }
+    configuration.flakeHuntingPolicy = flakeHuntingPolicy
+  }
+
 #if !SWT_NO_EXIT_TESTS
   // Enable exit test handling via __swiftPMEntryPoint().
   configuration.exitTestHandler = ExitTest.handlerForEntryPoint()
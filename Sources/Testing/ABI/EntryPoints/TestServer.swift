@@ -0,0 +1,167 @@
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for Swift project authors
+//
+
+#if canImport(Foundation) && !SWT_NO_FILE_IO && (SWT_TARGET_OS_APPLE || os(Linux) || os(FreeBSD) || os(Android))
+private import _TestingInternals
+
+/// Run tests repeatedly on behalf of clients that connect to a Unix domain
+/// socket.
+///
+/// - Parameters:
+///   - socketPath: The path at which to create the socket. No file may exist
+///     at this path.
+///
+/// - Throws: Any error that prevented the server from listening for or
+///   accepting connections. Errors that occur while serving a connection are
+///   written to the standard error stream and do not stop the server.
+///
+/// This function discovers tests once and then serves one connection at a
+/// time until the process is terminated. A client sends requests to the server
+/// in the [JSON Lines](https://jsonlines.org) text format. Each request is a
+/// JSON object with the same schema as the `configurationJSON` argument to
+/// ``ABIv0/entryPoint-swift.type.property`` (for instance, it can specify the
+/// `filter`, `skip`, and `repetitions` options.) For each request, the server
+/// runs the requested tests and writes records describing them to the
+/// connection in the format selected by the request's `eventStreamVersion`
+/// option, followed by a single line feed (`"\n"`) character. A run is
+/// complete when the server writes the record for its `runEnded` event.
+///
+/// If a request is malformed or cannot be converted to a configuration, the
+/// server closes the connection.
+///
+/// The runner plans constructed for each distinct combination of filtering
+/// and parallelization options are cached and reused by later requests, so
+/// traits are only prepared, and test arguments only evaluated, the first time
+/// a plan is used.
+func runTestServer(listeningAt socketPath: String) async throws -> Never {
+  let tests = await Array(Test.all)
+  while true {
+    try await serveTests(tests, listeningAt: socketPath, connectionCount: .max)
+  }
+}
+
+/// Run tests on behalf of a fixed number of clients that connect to a Unix
+/// domain socket.
+///
+/// - Parameters:
+///   - tests: The tests to serve.
+///   - socketPath: The path at which to create the socket. No file may exist
+///     at this path.
+///   - connectionCount: The number of connections to serve before returning.
+///
+/// - Throws: Any error that prevented the server from listening for or
+///   accepting connections. Errors that occur while serving a connection are
+///   written to the standard error stream and do not stop the server.
+///
+/// For more information, see ``runTestServer(listeningAt:)``. The socket is
+/// removed before this function returns.
+func serveTests(_ tests: [Test], listeningAt socketPath: String, connectionCount: Int) async throws {
+  let listeningFD = swt_unixDomainSocketListen(socketPath)
+  guard listeningFD != -1 else {
+    throw CError(rawValue: swt_errno())
+  }
+  defer {
+    _ = close(listeningFD)
+    _ = unlink(socketPath)
+  }
+
+#if !SWT_TARGET_OS_APPLE
+  // Accepted connections are configured to not raise SIGPIPE on Darwin, but
+  // there is no equivalent socket option on other platforms. Writing to a
+  // connection whose client has disconnected must not terminate the server.
+  _ = signal(SIGPIPE, SIG_IGN)
+#endif
+
+  var planCache = [_PlanCacheKey: Runner.Plan]()
+  for _ in 0 ..< connectionCount {
+    let connectionFD = swt_unixDomainSocketAccept(listeningFD)
+    guard connectionFD != -1 else {
+      throw CError(rawValue: swt_errno())
+    }
+    do {
+      try await _serveConnection(connectionFD, tests: tests, planCache: &planCache)
+    } catch {
+      try? FileHandle.stderr.write("\(error)\n")
+    }
+  }
+}
+
+/// A type describing the options of a request to a test server that affect
+/// the runner plan it uses.
+///
+/// Test filters cannot be compared, so the regular expressions they are
+/// constructed from are used instead. All other values are taken from the
+/// configuration resolved for the request rather than from the request itself,
+/// because other options (such as `--profile`) can override them.
+private struct _PlanCacheKey: Hashable {
+  /// The value of the request's `filter` option.
+  var filter: [String]?
+
+  /// The value of the request's `skip` option.
+  var skip: [String]?
+
+  /// The value of ``Configuration/isParallelizationEnabled`` resolved for the
+  /// request.
+  var isParallelizationEnabled: Bool
+
+  init(_ args: __CommandLineArguments_v0, configuration: Configuration) {
+    filter = args.filter
+    skip = args.skip
+    isParallelizationEnabled = configuration.isParallelizationEnabled
+  }
+}
+
+/// Serve requests on a connection to a test server until the client
+/// disconnects.
+///
+/// - Parameters:
+///   - connectionFD: The file descriptor of the connection. This function takes
+///     ownership of it and closes it before returning.
+///   - tests: The tests discovered by the server.
+///   - planCache: The runner plans the server has already constructed.
+///
+/// - Throws: Any error that occurred while reading or handling a request.
+private func _serveConnection(_ connectionFD: CInt, tests: [Test], planCache: inout [_PlanCacheKey: Runner.Plan]) async throws {
+  let output = try FileHandle(unsafePOSIXFileDescriptor: connectionFD, mode: "wb")
+  let input = try FileHandle(unsafePOSIXFileDescriptor: dup(connectionFD), mode: "rb")
+
+  while let requestJSON = try input.readLine() {
+    if requestJSON.isEmpty {
+      continue
+    }
+    let args = try requestJSON.withUnsafeBytes { requestJSON in
+      try JSON.decode(__CommandLineArguments_v0.self, from: requestJSON)
+    }
+
+    var configuration = try configurationForEntryPoint(from: args)
+    configuration.usesHumanReadableTestCaseArgumentIDs = true
+    let eventHandler = try eventHandlerForStreamingEvents(version: args.eventStreamVersion, encodeAsJSONLines: true) { json in
+      _ = try? output.withLock {
+        try output.write(json)
+        try output.write("\n")
+      }
+    }
+    configuration.eventHandler = { [oldEventHandler = configuration.eventHandler] event, context in
+      eventHandler(event, context)
+      oldEventHandler(event, context)
+    }
+
+    let planCacheKey = _PlanCacheKey(args, configuration: configuration)
+    let plan = if let plan = planCache[planCacheKey] {
+      plan
+    } else {
+      await Runner.Plan(tests: tests, configuration: configuration)
+    }
+    planCache[planCacheKey] = plan
+
+    await Runner(plan: plan, configuration: configuration).run()
+  }
+}
+#endif
@@ -28,6 +28,7 @@ extension ABIv0 {
       case testCaseStarted
       case issueRecorded
       case testCaseEnded
+      case testCaseRetried
       case testEnded
       case testSkipped
       case runEnded
@@ -45,6 +46,13 @@ extension ABIv0 {
     /// ``kind-swift.property`` property is ``Kind-swift.enum/issueRecorded``.
     var issue: EncodedIssue?
 
+    /// Whether a failed test case is flaky or consistently failing, if it was
+    /// retried.
+    ///
+    /// The value of this property is `nil` unless the value of the
+    /// ``kind-swift.property`` property is ``Kind-swift.enum/testCaseRetried``.
+    var retryResult: Configuration.RetryPolicy.Result?
+
     /// Human-readable messages associated with this event that can be presented
     /// to the user.
     var messages: [EncodedMessage]
@@ -76,6 +84,9 @@ extension ABIv0 {
           return nil
         }
         kind = .testCaseEnded
+      case let .testCaseRetried(result):
+        kind = .testCaseRetried
+        retryResult = result
       case .testEnded:
         kind = .testEnded
       case .testSkipped:
@@ -32,6 +32,12 @@ extension ABIv0 {
     /// - Warning: Errors are not yet part of the JSON schema.
     var _error: EncodedError?
 
+    /// The backtraces of the other threads in the process when this issue
+    /// occurred, if they were captured.
+    ///
+    /// - Warning: Thread backtraces are not yet part of the JSON schema.
+    var _threadBacktraces: [EncodedBacktrace]?
+
     init(encoding issue: borrowing Issue, in eventContext: borrowing Event.Context) {
       isKnown = issue.isKnown
       sourceLocation = issue.sourceLocation
@@ -41,6 +47,9 @@ extension ABIv0 {
       if let error = issue.error {
         _error = EncodedError(encoding: error, in: eventContext)
       }
+      if let threadBacktraces = issue.threadBacktraces {
+        _threadBacktraces = threadBacktraces.map { EncodedBacktrace(encoding: $0, in: eventContext) }
+      }
     }
   }
 }
@@ -22,39 +22,49 @@ extension Test {
     public struct Instant: Sendable {
       /// The suspending-clock time corresponding to this instant.
       fileprivate(set) var suspending: TimeValue = {
-#if !SWT_NO_TIMESPEC && SWT_TARGET_OS_APPLE
-        // The testing library's availability on Apple platforms is earlier than
-        // that of the Swift Clock API, so we don't use `SuspendingClock`
-        // directly on them and instead derive a value from platform-specific
-        // API. SuspendingClock corresponds to CLOCK_UPTIME_RAW on Darwin.
-        // SEE: https://github.com/swiftlang/swift/blob/main/stdlib/public/Concurrency/Clock.cpp
-        var uptime = timespec()
-        _ = clock_gettime(CLOCK_UPTIME_RAW, &uptime)
-        return TimeValue(uptime)
+#if SWT_TARGET_OS_APPLE || os(Linux) || os(Android)
+        // Read the suspending clock directly rather than going through
+        // `SuspendingClock`, whose availability on Apple platforms is later
+        // than the testing library's and which is comparatively expensive to
+        // convert from. Every event is timestamped, so this is a hot path.
+        TimeValue(nanoseconds: swt_clock_suspendingNanoseconds())
 #else
-        /// The corresponding suspending-clock time.
         TimeValue(SuspendingClock.Instant.now)
 #endif
       }()
 
 #if !SWT_NO_UTC_CLOCK
+      /// The wall-clock time corresponding to this instant, if it was not
+      /// derived from ``suspending``.
+      ///
+      /// The value of this property is only set when an instance is decoded, in
+      /// which case the wall clock was read by the process that encoded it.
+      private var _wall: TimeValue?
+
       /// The wall-clock time corresponding to this instant.
-      fileprivate(set) var wall: TimeValue = {
-#if !SWT_NO_TIMESPEC
+      ///
+      /// Reading the wall clock whenever an instant is created would double the
+      /// cost of timestamping events, most of which are never presented to a
+      /// user. Instead, the wall-clock time is derived from ``suspending`` when
+      /// it is needed, typically when an event is encoded or reported shortly
+      /// after it occurred.
+      var wall: TimeValue {
+        if let _wall {
+          return _wall
+        }
+#if SWT_TARGET_OS_APPLE || os(Linux) || os(Android)
+        return suspending.advanced(byNanoseconds: swt_clock_wallOffsetNanoseconds())
+#elseif !SWT_NO_TIMESPEC
+        // Estimate the offset from the current time on both clocks.
         var wall = timespec()
-#if os(Android)
-        // Android headers recommend `clock_gettime` over `timespec_get` which
-        // is available with API Level 29+ for `TIME_UTC`.
-        clock_gettime(CLOCK_REALTIME, &wall)
-#else
         timespec_get(&wall, TIME_UTC)
-#endif
-        return TimeValue(wall)
+        let now = Self()
+        return TimeValue(wall).advanced(byNanoseconds: now.nanoseconds(until: self))
 #else
 #warning("Platform-specific implementation missing: UTC time unavailable (no timespec)")
         return TimeValue((0, 0))
 #endif
-      }()
+      }
 #endif
 
       /// The current time according to the testing clock.
@@ -211,7 +221,9 @@ extension Test.Clock.Instant: InstantProtocol {
 
     result.suspending = TimeValue(Duration(result.suspending) + duration)
 #if !SWT_NO_UTC_CLOCK
-    result.wall = TimeValue(Duration(result.wall) + duration)
+    if let wall = result._wall {
+      result._wall = TimeValue(Duration(wall) + duration)
+    }
 #endif
 
     return result
@@ -244,4 +256,25 @@ extension Test.Clock.Instant {
 
 // MARK: - Codable
 
-extension Test.Clock.Instant: Codable {}
+extension Test.Clock.Instant: Codable {
+  private enum CodingKeys: String, CodingKey {
+    case suspending
+    case wall
+  }
+
+  public init(from decoder: any Decoder) throws {
+    let container = try decoder.container(keyedBy: CodingKeys.self)
+    suspending = try container.decode(TimeValue.self, forKey: .suspending)
+#if !SWT_NO_UTC_CLOCK
+    _wall = try container.decodeIfPresent(TimeValue.self, forKey: .wall)
+#endif
+  }
+
+  public func encode(to encoder: any Encoder) throws {
+    var container = encoder.container(keyedBy: CodingKeys.self)
+    try container.encode(suspending, forKey: .suspending)
+#if !SWT_NO_UTC_CLOCK
+    try container.encode(wall, forKey: .wall)
+#endif
+  }
+}
@@ -25,6 +25,19 @@ public struct Event: Sendable {
     /// regardless of whether or not they would run.
     case testDiscovered
 
+    /// The phases of starting a test run were measured.
+    ///
+    /// - Parameters:
+    ///   - startupProfile: How long each phase of starting the test run took.
+    ///
+    /// This event is posted by the testing library's entry point after it has
+    /// discovered tests and constructed a runner plan, and before it calls
+    /// ``Runner/run()``, so it precedes ``runStarted``. It is not posted when a
+    /// ``Runner`` is used directly, and it is not included in the JSON event
+    /// stream.
+    @_spi(Experimental)
+    indirect case startupMeasured(_ startupProfile: StartupProfile)
+
     /// A test run started.
     ///
     /// This event is posted when ``Runner/run()`` is called after
@@ -72,6 +85,12 @@ public struct Event: Sendable {
     ///
     /// The test case that ended is contained in the ``Event/Context`` instance
     /// that was passed to the event handler along with this event.
+    ///
+    /// If ``Configuration/countExpectationsChecked`` is `true`, the number of
+    /// expectations checked while the test case ran is available from the
+    /// event's ``Event/expectationCounts`` property. If allocations were
+    /// tracked while the test case ran, they are available from the event's
+    /// ``Event/allocationCounts`` property.
     case testCaseEnded
 
     /// An expectation was checked with `#expect()` or `#require()`.
@@ -98,6 +117,70 @@ public struct Event: Sendable {
     ///   - issue: The issue which was recorded.
     indirect case issueRecorded(_ issue: Issue)
 
+    /// A test case finished being benchmarked.
+    ///
+    /// - Parameters:
+    ///   - statistics: Statistics about the durations measured while
+    ///     benchmarking the test case.
+    ///
+    /// Events of this kind are posted for test cases whose test has a
+    /// ``BenchmarkTrait`` applied to it. The test case that was benchmarked is
+    /// contained in the ``Event/Context`` instance that was passed to the event
+    /// handler along with this event.
+    @_spi(Experimental)
+    indirect case benchmarkEnded(_ statistics: BenchmarkTrait.Statistics)
+
+    /// The performance counters of a test case were measured.
+    ///
+    /// - Parameters:
+    ///   - performanceCounters: The performance counters measured while the
+    ///     test case's body ran.
+    ///
+    /// Events of this kind are posted after the body of each test case runs
+    /// if ``Configuration/measurePerformanceCounters`` is `true` and
+    /// performance counters are available. The test case that was measured is
+    /// contained in the ``Event/Context`` instance that was passed to the event
+    /// handler along with this event.
+    @_spi(Experimental)
+    indirect case performanceCountersMeasured(_ performanceCounters: PerformanceCounters)
+
+    /// The call stacks of a test case were sampled.
+    ///
+    /// - Parameters:
+    ///   - profile: The call stacks sampled while the test case's body ran.
+    ///
+    /// Events of this kind are posted after the body of each test case runs
+    /// if ``Configuration/profileTestCases`` is `true` and profiling is
+    /// available. The test case that was profiled is contained in the
+    /// ``Event/Context`` instance that was passed to the event handler along
+    /// with this event.
+    @_spi(Experimental)
+    indirect case testCaseProfiled(_ profile: SamplingProfile)
+
+    /// A test case finished being repeated to find intermittent failures.
+    ///
+    /// - Parameters:
+    ///   - result: How often the test case failed.
+    ///
+    /// Events of this kind are posted for each test case that is run if
+    /// ``Configuration/flakeHuntingPolicy`` is not `nil`. The test case that was
+    /// repeated is contained in the ``Event/Context`` instance that was passed
+    /// to the event handler along with this event.
+    @_spi(Experimental)
+    indirect case flakeHuntEnded(_ result: FlakeHuntingPolicy.Result)
+
+    /// A test case that failed finished being retried.
+    ///
+    /// - Parameters:
+    ///   - result: Whether the test case is flaky or consistently failing.
+    ///
+    /// Events of this kind are posted for each test case that fails if
+    /// ``Configuration/retryPolicy-swift.property`` is not `nil`. The test case
+    /// that was retried is contained in the ``Event/Context`` instance that was
+    /// passed to the event handler along with this event.
+    @_spi(Experimental)
+    indirect case testCaseRetried(_ result: Configuration.RetryPolicy.Result)
+
     /// A test ended.
     ///
     /// The test that ended is contained in the ``Event/Context`` instance that
@@ -161,6 +244,69 @@ public struct Event: Sendable {
   /// The instant at which the event occurred.
   public var instant: Test.Clock.Instant
 
+  /// A type describing the number of expectations checked while a test case
+  /// ran.
+  public struct ExpectationCounts: Sendable, Codable, Equatable {
+    /// The number of expectations that passed.
+    public var passed = 0
+
+    /// The number of expectations that failed.
+    ///
+    /// Expectations that failed due to known issues are included in this
+    /// count.
+    public var failed = 0
+
+    /// The total number of expectations checked.
+    public var total: Int {
+      passed + failed
+    }
+  }
+
+  /// The number of expectations checked while the test case associated with
+  /// this event ran, if counted.
+  ///
+  /// The value of this property is `nil` unless ``kind-swift.property`` is
+  /// ``Kind-swift.enum/testCaseEnded`` and the configuration that ran the test
+  /// case set ``Configuration/countExpectationsChecked`` to `true`.
+  public var expectationCounts: ExpectationCounts?
+
+  /// A type describing the heap allocations made while a test case ran.
+  ///
+  /// Byte counts are the usable sizes of the allocated blocks as reported by
+  /// the system allocator, which may be larger than the sizes requested.
+  @_spi(Experimental)
+  public struct AllocationCounts: Sendable, Codable, Equatable {
+    /// The number of blocks allocated.
+    public var allocationCount = 0
+
+    /// The number of blocks deallocated.
+    public var deallocationCount = 0
+
+    /// The total size, in bytes, of all blocks allocated.
+    public var allocatedByteCount = 0
+
+    /// The total size, in bytes, of all blocks deallocated.
+    public var deallocatedByteCount = 0
+
+    /// The number of bytes allocated but not deallocated.
+    ///
+    /// A positive value may indicate a leak, but memory deallocated after the
+    /// test case ended (for example, by a cache) or by a different thread is
+    /// also included.
+    public var outstandingByteCount: Int {
+      allocatedByteCount - deallocatedByteCount
+    }
+  }
+
+  /// The heap allocations made while the test case associated with this event
+  /// ran, if tracked.
+  ///
+  /// The value of this property is `nil` unless ``kind-swift.property`` is
+  /// ``Kind-swift.enum/testCaseEnded`` and allocations were tracked for the
+  /// test case (see ``Configuration/trackAllocations``.)
+  @_spi(Experimental)
+  public var allocationCounts: AllocationCounts?
+
   /// Initialize an instance of this type.
   ///
   /// - Parameters:
@@ -191,6 +337,10 @@ public struct Event: Sendable {
   ///     ``Test/Case/current``.
   ///   - instant: The instant at which the event occurred. The default value
   ///     of this argument is `.now`.
+  ///   - expectationCounts: The number of expectations checked while the test
+  ///     case in `testAndTestCase` ran, if counted.
+  ///   - allocationCounts: The heap allocations made while the test case in
+  ///     `testAndTestCase` ran, if tracked.
   ///   - configuration: The configuration whose event handler should handle
   ///     this event. If `nil` is passed, the current task's configuration is
   ///     used, if known.
@@ -198,6 +348,8 @@ public struct Event: Sendable {
     _ kind: Kind,
     for testAndTestCase: (Test?, Test.Case?) = currentTestAndTestCase(),
     instant: Test.Clock.Instant = .now,
+    expectationCounts: ExpectationCounts? = nil,
+    allocationCounts: AllocationCounts? = nil,
     configuration: Configuration? = nil
   ) {
     // Create both the event and its associated context here at same point, to
@@ -206,7 +358,9 @@ public struct Event: Sendable {
     // reset it to the actual configuration that handles the event when we call
     // handleEvent() later, so there's no need to make a copy of it yet.
     let (test, testCase) = testAndTestCase
-    let event = Event(kind, testID: test?.id, testCaseID: testCase?.id, instant: instant)
+    var event = Event(kind, testID: test?.id, testCaseID: testCase?.id, instant: instant)
+    event.expectationCounts = expectationCounts
+    event.allocationCounts = allocationCounts
     let context = Event.Context(test: test, testCase: testCase, configuration: nil)
     event._post(in: context, configuration: configuration)
   }
@@ -325,6 +479,15 @@ extension Event {
     /// The instant at which the event occurred.
     public var instant: Test.Clock.Instant
 
+    /// The number of expectations checked while the test case associated with
+    /// this event ran, if counted.
+    public var expectationCounts: ExpectationCounts?
+
+    /// The heap allocations made while the test case associated with this
+    /// event ran, if tracked.
+    @_spi(Experimental)
+    public var allocationCounts: AllocationCounts?
+
     /// Snapshots an ``Event``.
     ///
     /// - Parameters:
@@ -334,6 +497,8 @@ extension Event {
       testID = event.testID
       testCaseID = event.testCaseID
       instant = event.instant
+      expectationCounts = event.expectationCounts
+      allocationCounts = event.allocationCounts
     }
   }
 }
@@ -353,6 +518,13 @@ extension Event.Kind {
     /// regardless of whether or not they would run.
     case testDiscovered
 
+    /// The phases of starting a test run were measured.
+    ///
+    /// - Parameters:
+    ///   - startupProfile: How long each phase of starting the test run took.
+    @_spi(Experimental)
+    indirect case startupMeasured(_ startupProfile: StartupProfile)
+
     /// A test run started.
     ///
     /// This event is posted when ``Runner/run()`` is called after
@@ -416,6 +588,43 @@ extension Event.Kind {
     ///   - issue: The issue which was recorded.
     indirect case issueRecorded(_ issue: Issue.Snapshot)
 
+    /// A test case finished being benchmarked.
+    ///
+    /// - Parameters:
+    ///   - statistics: Statistics about the durations measured while
+    ///     benchmarking the test case.
+    @_spi(Experimental)
+    indirect case benchmarkEnded(_ statistics: BenchmarkTrait.Statistics)
+
+    /// The performance counters of a test case were measured.
+    ///
+    /// - Parameters:
+    ///   - performanceCounters: The performance counters measured while the
+    ///     test case's body ran.
+    @_spi(Experimental)
+    indirect case performanceCountersMeasured(_ performanceCounters: PerformanceCounters)
+
+    /// The call stacks of a test case were sampled.
+    ///
+    /// - Parameters:
+    ///   - profile: The call stacks sampled while the test case's body ran.
+    @_spi(Experimental)
+    indirect case testCaseProfiled(_ profile: SamplingProfile)
+
+    /// A test case finished being repeated to find intermittent failures.
+    ///
+    /// - Parameters:
+    ///   - result: How often the test case failed.
+    @_spi(Experimental)
+    indirect case flakeHuntEnded(_ result: FlakeHuntingPolicy.Result)
+
+    /// A test case that failed finished being retried.
+    ///
+    /// - Parameters:
+    ///   - result: Whether the test case is flaky or consistently failing.
+    @_spi(Experimental)
+    indirect case testCaseRetried(_ result: Configuration.RetryPolicy.Result)
+
     /// A test ended.
     case testEnded
 
@@ -458,6 +667,8 @@ extension Event.Kind {
       switch kind {
       case .testDiscovered:
         self = .testDiscovered
+      case let .startupMeasured(startupProfile):
+        self = .startupMeasured(startupProfile)
       case .runStarted:
         self = .runStarted
       case let .iterationStarted(index):
@@ -475,6 +686,16 @@ extension Event.Kind {
         self = Snapshot.expectationChecked(expectationSnapshot)
       case let .issueRecorded(issue):
         self = .issueRecorded(Issue.Snapshot(snapshotting: issue))
+      case let .benchmarkEnded(statistics):
+        self = .benchmarkEnded(statistics)
+      case let .performanceCountersMeasured(performanceCounters):
+        self = .performanceCountersMeasured(performanceCounters)
+      case let .testCaseProfiled(profile):
+        self = .testCaseProfiled(profile)
+      case let .flakeHuntEnded(result):
+        self = .flakeHuntEnded(result)
+      case let .testCaseRetried(result):
+        self = .testCaseRetried(result)
       case .testEnded:
         self = .testEnded
       case let .testSkipped(skipInfo):
@@ -61,6 +61,22 @@ extension Event {
       public var useSFSymbols = false
 #endif
 
+      /// Whether or not to summarize progress on a single, periodically-updated
+      /// status line instead of writing a line for each event.
+      ///
+      /// When the value of this property is `true`, the recorder only writes
+      /// details about recorded issues and the summary at the end of the run.
+      /// In between, it maintains counts of started, finished, and skipped
+      /// tests and of recorded issues, and rewrites a status line showing them
+      /// at most ten times per second. If ``useANSIEscapeCodes`` is `false`,
+      /// the status line cannot be rewritten in place and is instead written as
+      /// a new line at most once every ten seconds.
+      ///
+      /// This option is useful for test runs with very many tests, where
+      /// writing a line for each event would make the destination stream a
+      /// bottleneck.
+      public var showsLiveProgress = false
+
       /// Storage for ``tagColors``.
       private var _tagColors = Tag.Color.predefined
 
@@ -103,6 +119,10 @@ extension Event {
     /// The underlying human-readable recorder.
     private var _humanReadableOutputRecorder = HumanReadableOutputRecorder()
 
+    /// The live progress tracked by this recorder, if
+    /// ``Options/showsLiveProgress`` is enabled.
+    private var _liveProgress: _LiveProgress?
+
     /// Initialize a new event recorder.
     ///
     /// - Parameters:
@@ -116,6 +136,9 @@ extension Event {
     public init(options: Options = .init(), writingUsing write: @escaping @Sendable (String) -> Void) {
       self.options = options
       self.write = write
+      if options.showsLiveProgress {
+        _liveProgress = _LiveProgress(redrawingInPlace: options.useANSIEscapeCodes)
+      }
     }
   }
 }
@@ -301,23 +324,42 @@ extension Event.ConsoleOutputRecorder {
   /// - Returns: Whether any output was produced and written to this instance's
   ///   destination.
   @discardableResult public func record(_ event: borrowing Event, in context: borrowing Event.Context) -> Bool {
+    if let _liveProgress {
+      return _record(event, in: context, withLiveProgress: _liveProgress)
+    }
+
     let messages = _humanReadableOutputRecorder.record(event, in: context)
+    if !messages.isEmpty {
+      write(_string(for: messages, in: context))
+    }
+    return !messages.isEmpty
+  }
+
+  /// Get the string to write for a sequence of messages.
+  ///
+  /// - Parameters:
+  ///   - messages: The messages to write.
+  ///   - context: The context associated with the event that produced
+  ///     `messages`.
+  ///
+  /// - Returns: A string containing each message in `messages` on its own line.
+  private func _string(for messages: [Event.HumanReadableOutputRecorder.Message], in context: borrowing Event.Context) -> String {
+    var result = ""
     for message in messages {
       let symbol = message.symbol?.stringValue(options: options) ?? " "
 
       if case .details = message.symbol, options.useANSIEscapeCodes, options.ansiColorBitDepth > 1 {
         // Special-case the detail symbol to apply grey to the entire line of
         // text instead of just the symbol.
-        write("\(_ansiEscapeCodePrefix)90m\(symbol) \(message.stringValue)\(_resetANSIEscapeCode)\n")
+        result += "\(_ansiEscapeCodePrefix)90m\(symbol) \(message.stringValue)\(_resetANSIEscapeCode)\n"
       } else {
         let colorDots = context.test.map(\.tags).map { self.colorDots(for: $0) } ?? ""
-        write("\(symbol) \(colorDots)\(message.stringValue)\n")
+        result += "\(symbol) \(colorDots)\(message.stringValue)\n"
       }
     }
-    return !messages.isEmpty
+    return result
   }
 
-
   /// Get a message warning the user of some condition in the library that may
   /// affect test results.
   ///
@@ -335,6 +377,148 @@ extension Event.ConsoleOutputRecorder {
   }
 }
 
+// MARK: - Live progress
+
+extension Event.ConsoleOutputRecorder {
+  /// A type that tracks progress through a test run for display on a single,
+  /// periodically-updated status line.
+  ///
+  /// Counts are updated atomically so that recording an event that produces no
+  /// other output does not need to take a lock.
+  fileprivate final class _LiveProgress: Sendable {
+    /// Whether or not the status line is redrawn in place using ANSI escape
+    /// codes.
+    let redrawsInPlace: Bool
+
+    /// The minimum interval, in nanoseconds, between redraws of the status
+    /// line.
+    let redrawIntervalNanoseconds: Int
+
+    /// The instant at which this instance was created.
+    let startInstant = Test.Clock.Instant.now
+
+    /// The number of tests (not including suites) that have started.
+    let startedCount = AtomicCounter(rawValue: 0)
+
+    /// The number of tests (not including suites) that have ended.
+    let endedCount = AtomicCounter(rawValue: 0)
+
+    /// The number of tests (not including suites) that were skipped.
+    let skippedCount = AtomicCounter(rawValue: 0)
+
+    /// The number of issues recorded that were not known issues.
+    let issueCount = AtomicCounter(rawValue: 0)
+
+    /// The time, in nanoseconds since ``startInstant``, before which the status
+    /// line should not be redrawn.
+    let nextRedrawNanoseconds = AtomicCounter(rawValue: 0)
+
+    init(redrawingInPlace redrawsInPlace: Bool) {
+      self.redrawsInPlace = redrawsInPlace
+      redrawIntervalNanoseconds = redrawsInPlace ? 100_000_000 : 10_000_000_000
+    }
+
+    /// Update the counts tracked by this instance for an event.
+    ///
+    /// - Parameters:
+    ///   - event: The event that occurred.
+    ///   - context: The context associated with the event.
+    func update(for event: borrowing Event, in context: borrowing Event.Context) {
+      switch event.kind {
+      case .testStarted where false == context.test?.isSuite:
+        startedCount.increment()
+      case .testEnded where false == context.test?.isSuite:
+        endedCount.increment()
+      case .testSkipped where false == context.test?.isSuite:
+        skippedCount.increment()
+      case let .issueRecorded(issue) where !issue.isKnown:
+        issueCount.increment()
+      default:
+        break
+      }
+    }
+
+    /// Claim the right to redraw the status line at a given instant.
+    ///
+    /// - Parameters:
+    ///   - instant: The instant at which the caller wants to redraw.
+    ///   - force: Whether to redraw even if the status line was recently
+    ///     redrawn.
+    ///
+    /// - Returns: Whether or not the caller should redraw the status line. If
+    ///   several threads call this function at once, at most one of them is
+    ///   told to redraw.
+    func claimRedraw(at instant: Test.Clock.Instant, force: Bool = false) -> Bool {
+      let nanoseconds = Int(startInstant.nanoseconds(until: instant))
+      let nextRedrawNanoseconds = nextRedrawNanoseconds.rawValue
+      guard force || nanoseconds >= nextRedrawNanoseconds else {
+        return false
+      }
+      return self.nextRedrawNanoseconds.compareExchange(
+        expected: nextRedrawNanoseconds,
+        desired: nanoseconds + redrawIntervalNanoseconds
+      )
+    }
+
+    /// The status line describing the current state of this instance.
+    ///
+    /// - Parameters:
+    ///   - instant: The instant at which the status line will be written.
+    func statusLine(at instant: Test.Clock.Instant) -> String {
+      let endedCount = endedCount.rawValue
+      let runningCount = max(0, startedCount.rawValue - endedCount)
+      let skippedCount = skippedCount.rawValue
+      let issueCount = issueCount.rawValue
+      let duration = startInstant.descriptionOfDuration(to: instant)
+      return "\(endedCount.counting("test")) finished, \(runningCount) running, \(skippedCount) skipped, \(issueCount.counting("issue")) after \(duration)"
+    }
+  }
+
+  /// Record the specified event while showing live progress.
+  ///
+  /// - Parameters:
+  ///   - event: The event to record.
+  ///   - context: The context associated with the event.
+  ///   - liveProgress: The live progress tracked by this instance.
+  ///
+  /// - Returns: Whether any output was produced and written to this instance's
+  ///   destination.
+  ///
+  /// Only the messages that would be written in quiet mode (the start of the
+  /// run, recorded issues, and the end of the run) are written in full. All
+  /// other events only update the status line.
+  private func _record(_ event: borrowing Event, in context: borrowing Event.Context, withLiveProgress liveProgress: _LiveProgress) -> Bool {
+    liveProgress.update(for: event, in: context)
+
+    let verbosity = min(context.configuration?.verbosity ?? 0, -1)
+    let messages = _humanReadableOutputRecorder.record(event, in: context, verbosity: verbosity)
+
+    // Clear the status line before writing anything else over it.
+    let clearLine = liveProgress.redrawsInPlace ? "\r\(_ansiEscapeCodePrefix)2K" : ""
+
+    var output = ""
+    if !messages.isEmpty {
+      output += clearLine
+      output += _string(for: messages, in: context)
+    }
+    if case .runEnded = event.kind {
+      // The final summary has been written, so don't draw the status line again.
+    } else if liveProgress.claimRedraw(at: event.instant, force: liveProgress.redrawsInPlace && !messages.isEmpty) {
+      if liveProgress.redrawsInPlace {
+        output += "\(clearLine)\(liveProgress.statusLine(at: event.instant))"
+      } else {
+        output += "\(liveProgress.statusLine(at: event.instant))\n"
+      }
+    }
+
+    if !output.isEmpty {
+      write(output)
+      return true
+    }
+    return false
+  }
+}
+
 // MARK: - Deprecated
 
 extension Event.ConsoleOutputRecorder.Options {
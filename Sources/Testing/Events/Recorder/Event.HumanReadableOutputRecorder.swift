@@ -119,6 +119,32 @@ extension Event.HumanReadableOutputRecorder {
     _formattedComments(test.comments(from: Comment.self))
   }
 
+  /// Get a string representing the backtraces of other threads attached to an
+  /// issue, formatted for output.
+  ///
+  /// - Parameters:
+  ///   - threadBacktraces: The backtraces to format.
+  ///   - symbolicationMode: How to symbolicate the addresses in
+  ///     `threadBacktraces`.
+  ///
+  /// - Returns: A formatted string representing `threadBacktraces`, one
+  ///   message per line.
+  private func _formattedThreadBacktraces(_ threadBacktraces: [Backtrace], symbolicationMode: Backtrace.SymbolicationMode) -> [Message] {
+    threadBacktraces.enumerated().flatMap { i, backtrace in
+      let frames = backtrace.symbolicate(symbolicationMode).enumerated().map { j, frame in
+        var line = "#\(j) 0x\(String(frame.address, radix: 16))"
+        if let symbolName = frame.symbolName {
+          line += " \(symbolName)"
+          if let offset = frame.offset {
+            line += " + \(offset)"
+          }
+        }
+        return Message(stringValue: line)
+      }
+      return CollectionOfOne(Message(symbol: .details, stringValue: "Thread \(i + 1) of \(threadBacktraces.count):")) + frames
+    }
+  }
+
   /// Get the total number of issues recorded in a graph of test data
   /// structures.
   ///
@@ -312,6 +338,18 @@ extension Event.HumanReadableOutputRecorder {
       // interesting in human-readable output.
       break
 
+    case let .startupMeasured(startupProfile):
+      if verbosity > 0 {
+        let totalDuration = BenchmarkTrait.Statistics.descriptionOfNanoseconds(Double(startupProfile.totalNanoseconds))
+        return [
+          Message(
+            symbol: .details,
+            stringValue: "Startup took \(totalDuration): \(startupProfile.summary).",
+            conciseStringValue: startupProfile.summary
+          )
+        ]
+      }
+
     case .runStarted:
       var comments = [Comment]()
       if verbosity > 0 {
@@ -426,6 +464,10 @@ extension Event.HumanReadableOutputRecorder {
         additionalMessages.append(Message(symbol: .difference, stringValue: differenceDescription))
       }
       additionalMessages += _formattedComments(issue.comments)
+      if let threadBacktraces = issue.threadBacktraces {
+        let symbolicationMode = eventContext.configuration?.backtraceSymbolicationMode ?? .demangled
+        additionalMessages += _formattedThreadBacktraces(threadBacktraces, symbolicationMode: symbolicationMode)
+      }
 
       if verbosity > 0, case let .expectationFailed(expectation) = issue.kind {
         let expression = expectation.evaluatedExpression
@@ -459,6 +501,84 @@ extension Event.HumanReadableOutputRecorder {
       }
       return CollectionOfOne(primaryMessage) + additionalMessages
 
+    case let .benchmarkEnded(statistics):
+      let labeledArguments = if let testCase = eventContext.testCase, testCase.isParameterized {
+        " with \(testCase.arguments.count.counting("argument")) \(testCase.labeledArguments())"
+      } else {
+        ""
+      }
+      return [
+        Message(
+          symbol: .details,
+          stringValue: "\(_capitalizedTitle(for: test)) \(testName)\(labeledArguments) benchmarked: \(statistics.summary).",
+          conciseStringValue: statistics.summary
+        )
+      ]
+
+    case let .performanceCountersMeasured(performanceCounters):
+      let labeledArguments = if let testCase = eventContext.testCase, testCase.isParameterized {
+        " with \(testCase.arguments.count.counting("argument")) \(testCase.labeledArguments())"
+      } else {
+        ""
+      }
+      let summary = performanceCounters.summary
+      return [
+        Message(
+          symbol: .details,
+          stringValue: "\(_capitalizedTitle(for: test)) \(testName)\(labeledArguments) measured: \(summary).",
+          conciseStringValue: summary
+        )
+      ]
+
+    case let .testCaseProfiled(profile):
+      let labeledArguments = if let testCase = eventContext.testCase, testCase.isParameterized {
+        " with \(testCase.arguments.count.counting("argument")) \(testCase.labeledArguments())"
+      } else {
+        ""
+      }
+      let summary = profile.summary
+      return [
+        Message(
+          symbol: .details,
+          stringValue: "\(_capitalizedTitle(for: test)) \(testName)\(labeledArguments) profiled: \(summary).",
+          conciseStringValue: summary
+        )
+      ]
+
+    case let .flakeHuntEnded(result):
+      let labeledArguments = if let testCase = eventContext.testCase, testCase.isParameterized {
+        " with \(testCase.arguments.count.counting("argument")) \(testCase.labeledArguments())"
+      } else {
+        ""
+      }
+      let summary = result.summary
+      return [
+        Message(
+          symbol: .details,
+          stringValue: "\(_capitalizedTitle(for: test)) \(testName)\(labeledArguments) \(summary).",
+          conciseStringValue: summary
+        )
+      ]
+
+    case let .testCaseRetried(result):
+      let labeledArguments = if let testCase = eventContext.testCase, testCase.isParameterized {
+        " with \(testCase.arguments.count.counting("argument")) \(testCase.labeledArguments())"
+      } else {
+        ""
+      }
+      let summary = result.summary
+      // Issues recorded while retrying are not posted as events of their own,
+      // so include them here.
+      return CollectionOfOne(
+        Message(
+          symbol: .details,
+          stringValue: "\(_capitalizedTitle(for: test)) \(testName)\(labeledArguments) \(summary).",
+          conciseStringValue: summary
+        )
+      ) + result.failureDescriptions.map { failureDescription in
+        Message(symbol: .details, stringValue: "Retry failed: \(failureDescription)")
+      }
+
     case .testCaseStarted:
       guard let testCase = eventContext.testCase, testCase.isParameterized else {
         break
@@ -14,11 +14,25 @@ extension Event {
   ///
   /// The maintainers of JUnit do not publish a formal XML schema. A _de facto_
   /// schema is described in the [JUnit repository](https://github.com/junit-team/junit5/blob/main/junit-platform-reporting/src/main/java/org/junit/platform/reporting/legacy/xml/XmlReportWriter.java).
+  ///
+  /// By default, an instance of this type keeps the results of every test in
+  /// memory and writes them when the run ends. If its destination supports
+  /// overwriting previously-written output (see
+  /// ``init(writingUsing:rewritingUsing:)``), it instead writes each test's
+  /// results as soon as that test ends and keeps only the results of tests
+  /// that are still running in memory.
   @_spi(ForToolsIntegrationOnly)
   public struct JUnitXMLRecorder: Sendable/*, ~Copyable*/ {
     /// The write function for this event recorder.
     var write: @Sendable (String) -> Void
 
+    /// The function this event recorder uses to overwrite previously-written
+    /// output, if any.
+    ///
+    /// If the value of this property is not `nil`, this event recorder streams
+    /// its output.
+    var rewrite: (@Sendable (_ string: String, _ offset: Int) -> Void)?
+
     /// A type that contains mutable context for ``Event/JUnitXMLRecorder``.
     ///
     /// - Bug: Although the data being tracked is different, this type could
@@ -34,8 +48,70 @@ extension Event {
       var testCount = 0
 
       /// Any recorded issues where the test was not known.
+      ///
+      /// This array is only populated when not streaming output.
       var issuesForUnknownTests = [Issue]()
 
+      /// The number of issues recorded where the test was not known.
+      var unknownTestIssueCount = 0
+
+      /// The number of issues recorded for each test during the run.
+      ///
+      /// Issues recorded for a test are counted whether or not the test is
+      /// running when they are recorded. Issues recorded for test suites are
+      /// not counted.
+      var issueCounts = [Test.ID: Int]()
+
+      /// The verdict for each test whose failed test cases were retried.
+      ///
+      /// If any of a test's test cases failed consistently, its verdict is
+      /// ``Configuration/RetryPolicy/Result/Verdict/consistentlyFailing``.
+      var retryVerdicts = [Test.ID: Configuration.RetryPolicy.Result.Verdict]()
+
+      /// The number of tests skipped during the run.
+      ///
+      /// This value does not include test suites.
+      var skipCount = 0
+
+      /// The number of failures to report for the run.
+      ///
+      /// Both buffered and streaming output report this value, so they count
+      /// failures the same way: each unknown issue recorded for a test or for
+      /// no test counts, except that a test whose failed test cases all passed
+      /// when retried is flaky and its issues do not count.
+      var failureCount: Int {
+        let testIssueCount = issueCounts.lazy
+          .filter { retryVerdicts[$0.key] != .flaky }
+          .map { $0.value }
+          .reduce(0, +)
+        return testIssueCount + unknownTestIssueCount
+      }
+
+      /// Count an unknown issue toward the failures reported for the run.
+      ///
+      /// - Parameters:
+      ///   - test: The test for which the issue was recorded, if known.
+      mutating func countIssue(for test: Test?) {
+        if let test {
+          if !test.isSuite {
+            issueCounts[test.id, default: 0] += 1
+          }
+        } else {
+          unknownTestIssueCount += 1
+        }
+      }
+
+      /// Note the result of retrying one of a test's failed test cases.
+      ///
+      /// - Parameters:
+      ///   - verdict: The verdict for the retried test case.
+      ///   - id: The ID of the test the test case belongs to.
+      mutating func noteRetryVerdict(_ verdict: Configuration.RetryPolicy.Result.Verdict, forTestWithID id: Test.ID) {
+        if retryVerdicts[id] != .consistentlyFailing {
+          retryVerdicts[id] = verdict
+        }
+      }
+
       /// A type describing data tracked on a per-test basis.
       struct TestData: Sendable {
         /// The ID of the test.
@@ -50,12 +126,29 @@ extension Event {
         /// Any issues recorded for the test.
         var issues = [Issue]()
 
+        /// Descriptions of the issues recorded while the test's failed test
+        /// cases were retried.
+        var retryFailureDescriptions = [String]()
+
+        /// The verdict for the test's failed test cases, if any were retried.
+        ///
+        /// If any of the test's test cases failed consistently, the value of
+        /// this property is ``Configuration/RetryPolicy/Result/Verdict/consistentlyFailing``.
+        var retryVerdict: Configuration.RetryPolicy.Result.Verdict?
+
         /// Information about the test if it was skipped.
         var skipInfo: SkipInfo?
       }
 
       /// Data tracked on a per-test basis.
+      ///
+      /// This graph is only populated when not streaming output.
       var testData = Graph<String, TestData?>()
+
+      /// Data tracked for tests that have started but not yet ended.
+      ///
+      /// This dictionary is only populated when streaming output.
+      var inFlightTestData = [Test.ID: TestData]()
     }
 
     /// This event recorder's mutable context about events it has received,
@@ -72,6 +165,33 @@ extension Event {
     init(writingUsing write: @escaping @Sendable (String) -> Void) {
       self.write = write
     }
+
+    /// Initialize a new event recorder that writes the results of each test as
+    /// soon as that test ends.
+    ///
+    /// - Parameters:
+    ///   - write: A closure that writes output to its destination. The closure
+    ///     may be invoked concurrently.
+    ///   - rewrite: A closure that overwrites output previously written by
+    ///     `write`. Its arguments are the replacement string and the offset, in
+    ///     bytes from the start of this event recorder's output, at which to
+    ///     write it. The replacement string has the same length in UTF-8 as the
+    ///     output it replaces.
+    ///
+    /// The aggregate counts for the run must be written at the start of the
+    /// output, before the results of any individual test. An event recorder
+    /// created with this initializer writes a fixed-width placeholder for them
+    /// when the run starts and replaces it using `rewrite` when the run ends.
+    /// Output written before the run ends is well-formed up to the most
+    /// recently-ended test, so partial results are available even if the
+    /// process terminates early.
+    init(
+      writingUsing write: @escaping @Sendable (String) -> Void,
+      rewritingUsing rewrite: @escaping @Sendable (_ string: String, _ offset: Int) -> Void
+    ) {
+      self.write = write
+      self.rewrite = rewrite
+    }
   }
 }
 
@@ -86,6 +206,10 @@ extension Event.JUnitXMLRecorder {
   /// - Returns: A string description of the event, or `nil` if there is nothing
   ///   useful to output for this event.
   private func _record(_ event: borrowing Event, in eventContext: borrowing Event.Context) -> String? {
+    if let rewrite {
+      return _recordStreaming(event, in: eventContext, rewritingUsing: rewrite)
+    }
+
     let instant = event.instant
     let test = eventContext.test
 
@@ -94,11 +218,7 @@ extension Event.JUnitXMLRecorder {
       _context.withLock { context in
         context.runStartInstant = instant
       }
-      return #"""
-        <?xml version="1.0" encoding="UTF-8"?>
-        <testsuites>
-
-        """#
+      return Self._prefix
     case .testStarted where false == test?.isSuite:
       let id = test!.id
       let keyPath = id.keyPathRepresentation
@@ -118,6 +238,7 @@ extension Event.JUnitXMLRecorder {
       let id = test!.id
       let keyPath = id.keyPathRepresentation
       _context.withLock { context in
+        context.skipCount += 1
         context.testData[keyPath] = _Context.TestData(id: id, startInstant: instant, skipInfo: skipInfo)
       }
       return nil
@@ -125,29 +246,31 @@ extension Event.JUnitXMLRecorder {
       if issue.isKnown {
         return nil
       }
-      if let id = test?.id {
-        let keyPath = id.keyPathRepresentation
-        _context.withLock { context in
-          context.testData[keyPath]?.issues.append(issue)
-        }
-      } else {
-        _context.withLock { context in
+      _context.withLock { context in
+        context.countIssue(for: test)
+        if let id = test?.id {
+          context.testData[id.keyPathRepresentation]?.issues.append(issue)
+        } else {
           context.issuesForUnknownTests.append(issue)
         }
       }
       return nil
+    case let .testCaseRetried(result) where false == test?.isSuite:
+      let id = test!.id
+      let keyPath = id.keyPathRepresentation
+      _context.withLock { context in
+        context.noteRetryVerdict(result.verdict, forTestWithID: id)
+        context.testData[keyPath]?.retryVerdict = context.retryVerdicts[id]
+        context.testData[keyPath]?.retryFailureDescriptions += result.failureDescriptions
+      }
+      return nil
     case .runEnded:
       return _context.withLock { context in
-        let issueCount = context.testData
-          .compactMap(\.value?.issues.count)
-          .reduce(into: 0, +=) + context.issuesForUnknownTests.count
-        let skipCount = context.testData
-          .compactMap(\.value?.skipInfo)
-          .count
         let durationNanoseconds = context.runStartInstant.map { $0.nanoseconds(until: instant) } ?? 0
         let durationSeconds = Double(durationNanoseconds) / 1_000_000_000
+        let startTag = Self._testSuiteStartTag(testCount: context.testCount, issueCount: context.failureCount, skipCount: context.skipCount, durationSeconds: durationSeconds)
         return #"""
-            <testsuite name="TestResults" errors="0" tests="\#(context.testCount)" failures="\#(issueCount)" skipped="\#(skipCount)" time="\#(durationSeconds)">
+          \#(startTag)
           \#(Self._xml(for: context.testData))
             </testsuite>
           </testsuites>
@@ -159,6 +282,136 @@ extension Event.JUnitXMLRecorder {
     }
   }
 
+  /// The prefix written before the `<testsuite>` element.
+  private static let _prefix = #"""
+    <?xml version="1.0" encoding="UTF-8"?>
+    <testsuites>
+
+    """#
+
+  /// The width, in UTF-8 code units, of the `<testsuite>` start tag written
+  /// when streaming output.
+  ///
+  /// This width is large enough to contain the largest possible values of the
+  /// element's attributes.
+  private static let _streamingTestSuiteStartTagWidth = 256
+
+  /// Generate the `<testsuite>` start tag.
+  ///
+  /// - Parameters:
+  ///   - testCount: The number of tests run.
+  ///   - issueCount: The number of issues recorded.
+  ///   - skipCount: The number of tests skipped.
+  ///   - durationSeconds: The duration of the run in seconds.
+  ///   - width: If not `nil`, the width in UTF-8 code units to pad the result
+  ///     to.
+  ///
+  /// - Returns: A string containing the `<testsuite>` start tag.
+  private static func _testSuiteStartTag(testCount: Int, issueCount: Int, skipCount: Int, durationSeconds: Double, paddedTo width: Int? = nil) -> String {
+    var result = #"  <testsuite name="TestResults" errors="0" tests="\#(testCount)" failures="\#(issueCount)" skipped="\#(skipCount)" time="\#(durationSeconds)""#
+    if let width {
+      // Whitespace is permitted between the last attribute and the end of the
+      // start tag, so use it as padding.
+      let paddingCount = width - result.utf8.count - 1
+      precondition(paddingCount >= 0, "<testsuite> start tag exceeded its reserved width: \(result)")
+      result += String(repeating: " ", count: paddingCount)
+    }
+    result += ">"
+    return result
+  }
+
+  /// Record the specified event when this instance streams its output.
+  ///
+  /// - Parameters:
+  ///   - event: The event to record.
+  ///   - eventContext: The context associated with the event.
+  ///   - rewrite: The function to use to replace the placeholder `<testsuite>`
+  ///     start tag when the run ends.
+  ///
+  /// - Returns: A string description of the event, or `nil` if there is nothing
+  ///   useful to output for this event.
+  ///
+  /// Unlike ``_record(_:in:)``, this function does not keep the results of
+  /// tests that have ended. Issues recorded for a test after it ends are
+  /// counted, but are not listed in its `<testcase>` element. For the same
+  /// reason, tests are not marked flaky or consistently failing when their
+  /// failed test cases are retried, although the failure count for the run
+  /// takes their verdicts into account. The counts for the run are the same as
+  /// those written by ``_record(_:in:)`` for the same events.
+  private func _recordStreaming(_ event: borrowing Event, in eventContext: borrowing Event.Context, rewritingUsing rewrite: @Sendable (_ string: String, _ offset: Int) -> Void) -> String? {
+    let instant = event.instant
+    let test = eventContext.test
+
+    switch event.kind {
+    case .runStarted:
+      _context.withLock { context in
+        context.runStartInstant = instant
+      }
+      let startTag = Self._testSuiteStartTag(testCount: 0, issueCount: 0, skipCount: 0, durationSeconds: 0, paddedTo: Self._streamingTestSuiteStartTagWidth)
+      return "\(Self._prefix)\(startTag)\n"
+    case .testStarted where false == test?.isSuite:
+      let id = test!.id
+      _context.withLock { context in
+        context.testCount += 1
+        context.inFlightTestData[id] = _Context.TestData(id: id, startInstant: instant)
+      }
+      return nil
+    case .testEnded where false == test?.isSuite:
+      let id = test!.id
+      let testData = _context.withLock { context in
+        context.inFlightTestData.removeValue(forKey: id)
+      }
+      guard var testData else {
+        return nil
+      }
+      testData.endInstant = instant
+      return "\(Self._xml(for: testData))\n"
+    case let .testSkipped(skipInfo) where false == test?.isSuite:
+      let id = test!.id
+      _context.withLock { context in
+        context.skipCount += 1
+      }
+      let testData = _Context.TestData(id: id, startInstant: instant, skipInfo: skipInfo)
+      return "\(Self._xml(for: testData))\n"
+    case let .issueRecorded(issue):
+      if issue.isKnown {
+        return nil
+      }
+      _context.withLock { context in
+        context.countIssue(for: test)
+        if let id = test?.id {
+          context.inFlightTestData[id]?.issues.append(issue)
+        }
+      }
+      return nil
+    case let .testCaseRetried(result) where false == test?.isSuite:
+      _context.withLock { context in
+        context.noteRetryVerdict(result.verdict, forTestWithID: test!.id)
+      }
+      return nil
+    case .runEnded:
+      let startTag = _context.withLock { context in
+        let durationNanoseconds = context.runStartInstant.map { $0.nanoseconds(until: instant) } ?? 0
+        let durationSeconds = Double(durationNanoseconds) / 1_000_000_000
+        return Self._testSuiteStartTag(
+          testCount: context.testCount,
+          issueCount: context.failureCount,
+          skipCount: context.skipCount,
+          durationSeconds: durationSeconds,
+          paddedTo: Self._streamingTestSuiteStartTagWidth
+        )
+      }
+      rewrite(startTag, Self._prefix.utf8.count)
+      return #"""
+          </testsuite>
+        </testsuites>
+
+        """#
+    default:
+      return nil
+    }
+  }
+
   /// Generate XML for a graph of test data.
   ///
   /// - Parameters:
@@ -169,49 +422,68 @@ extension Event.JUnitXMLRecorder {
   /// This function calls itself recursively as it walks `testDataGraph` in
   /// order to build up the XML output for all nodes therein.
   private static func _xml(for testDataGraph: Graph<String, _Context.TestData?>) -> String {
-    var result = [String]()
-
     if let testData = testDataGraph.value {
-      let id = testData.id
-      let classNameComponents = CollectionOfOne(id.moduleName) + id.nameComponents.dropLast()
-      let className = classNameComponents.joined(separator: ".")
-      let name = id.nameComponents.last!
-
-      // Tests that are skipped or for some reason never completed will not have
-      // an end instant; don't report timing for such tests.
-      var timeClause = ""
-      if let endInstant = testData.endInstant {
-        let durationNanoseconds = testData.startInstant.nanoseconds(until: endInstant)
-        let durationSeconds = Double(durationNanoseconds) / 1_000_000_000
-        timeClause = #"time="\#(durationSeconds)" "#
-      }
+      return _xml(for: testData)
+    }
+    return testDataGraph.children.values.lazy
+      .map { _xml(for: $0) }
+      .joined(separator: "\n")
+  }
 
-      // Build out any child nodes contained within this <testcase> node.
-      var minutiae = [String]()
-      for issue in testData.issues.lazy.map(String.init(describingForTest:)) {
-        minutiae.append(#"      <failure message="\#(Self._escapeForXML(issue))" />"#)
-      }
-      if let skipInfo = testData.skipInfo {
-        if let comment = skipInfo.comment.map(String.init(describingForTest:)) {
-          minutiae.append(#"      <skipped>\#(Self._escapeForXML(comment))</skipped>"#)
-        } else {
-          minutiae.append(#"      <skipped />"#)
-        }
-      }
+  /// Generate XML for a single test.
+  ///
+  /// - Parameters:
+  ///   - testData: The data tracked for the test.
+  ///
+  /// - Returns: A string containing the `<testcase>` element for the test.
+  private static func _xml(for testData: _Context.TestData) -> String {
+    let id = testData.id
+    let classNameComponents = CollectionOfOne(id.moduleName) + id.nameComponents.dropLast()
+    let className = classNameComponents.joined(separator: ".")
+    let name = id.nameComponents.last!
 
-      if minutiae.isEmpty {
-        result.append(#"    <testcase classname="\#(className)" name="\#(name)" \#(timeClause)/>"#)
+    // Tests that are skipped or for some reason never completed will not have
+    // an end instant; don't report timing for such tests.
+    var timeClause = ""
+    if let endInstant = testData.endInstant {
+      let durationNanoseconds = testData.startInstant.nanoseconds(until: endInstant)
+      let durationSeconds = Double(durationNanoseconds) / 1_000_000_000
+      timeClause = #"time="\#(durationSeconds)" "#
+    }
+
+    // Build out any child nodes contained within this <testcase> node. If the
+    // test's failed test cases were retried, use the elements that Maven
+    // Surefire uses to describe flaky and consistently failing tests.
+    let (failureElementName, retryFailureElementName) = switch testData.retryVerdict {
+    case .flaky:
+      ("flakyFailure", "flakyFailure")
+    case .consistentlyFailing:
+      ("failure", "rerunFailure")
+    case nil:
+      ("failure", "failure")
+    }
+    var minutiae = [String]()
+    for issue in testData.issues.lazy.map(String.init(describingForTest:)) {
+      minutiae.append(#"      <\#(failureElementName) message="\#(Self._escapeForXML(issue))" />"#)
+    }
+    for failureDescription in testData.retryFailureDescriptions {
+      minutiae.append(#"      <\#(retryFailureElementName) message="\#(Self._escapeForXML(failureDescription))" />"#)
+    }
+    if let skipInfo = testData.skipInfo {
+      if let comment = skipInfo.comment.map(String.init(describingForTest:)) {
+        minutiae.append(#"      <skipped>\#(Self._escapeForXML(comment))</skipped>"#)
       } else {
-        result.append(#"    <testcase classname="\#(className)" name="\#(name)" \#(timeClause)>"#)
-        result += minutiae
-        result.append(#"    </testcase>"#)
-      }
-    } else {
-      for childGraph in testDataGraph.children.values {
-        result.append(_xml(for: childGraph))
+        minutiae.append(#"      <skipped />"#)
       }
     }
 
+    if minutiae.isEmpty {
+      return #"    <testcase classname="\#(className)" name="\#(name)" \#(timeClause)/>"#
+    }
+    var result = [String]()
+    result.append(#"    <testcase classname="\#(className)" name="\#(name)" \#(timeClause)>"#)
+    result += minutiae
+    result.append(#"    </testcase>"#)
     return result.joined(separator: "\n")
   }
 
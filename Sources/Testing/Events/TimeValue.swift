@@ -41,6 +41,11 @@ struct TimeValue: Sendable {
     (seconds, attoseconds) = components
   }
 
+  init(nanoseconds: UInt64) {
+    let (seconds, nanosecondsRemaining) = nanoseconds.quotientAndRemainder(dividingBy: 1_000_000_000)
+    self.init((Int64(seconds), Int64(nanosecondsRemaining) * 1_000_000_000))
+  }
+
 #if !SWT_NO_TIMESPEC
   init(_ timespec: timespec) {
     self.init((Int64(timespec.tv_sec), Int64(timespec.tv_nsec) * 1_000_000_000))
@@ -58,6 +63,33 @@ struct TimeValue: Sendable {
   }
 }
 
+// MARK: - Arithmetic
+
+extension TimeValue {
+  /// Get a copy of this instance offset by a number of nanoseconds.
+  ///
+  /// - Parameters:
+  ///   - nanoseconds: The number of nanoseconds to offset this instance by.
+  ///     This value may be negative.
+  ///
+  /// - Returns: A copy of `self` offset by `nanoseconds`.
+  ///
+  /// Unlike `Duration`, this function is available on all platforms the
+  /// testing library supports.
+  func advanced(byNanoseconds nanoseconds: Int64) -> Self {
+    let (secondsOffset, nanosecondsOffset) = nanoseconds.quotientAndRemainder(dividingBy: 1_000_000_000)
+    var result = Self((seconds + secondsOffset, attoseconds + nanosecondsOffset * 1_000_000_000))
+    if result.attoseconds >= 1_000_000_000_000_000_000 {
+      result.seconds += 1
+      result.attoseconds -= 1_000_000_000_000_000_000
+    } else if result.attoseconds < 0 {
+      result.seconds -= 1
+      result.attoseconds += 1_000_000_000_000_000_000
+    }
+    return result
+  }
+}
+
 // MARK: - Equatable, Hashable, Comparable
 
 extension TimeValue: Equatable, Hashable, Comparable {
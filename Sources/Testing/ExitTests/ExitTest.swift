@@ -77,6 +77,27 @@ public struct ExitTest: Sendable, ~Copyable {
   /// The source location is unique to each exit test and is consistent between
   /// processes, so it can be used to uniquely identify an exit test at runtime.
   public var sourceLocation: SourceLocation
+
+  /// A type describing a failed test case that a child process should run in
+  /// place of an exit test's body.
+  struct RetriedTestCase: Sendable, Codable {
+    /// The ID of the test whose test case should be run.
+    var testID: Test.ID
+
+    /// The ID of the test case to run.
+    var testCaseID: Test.Case.ID
+
+    /// The value of ``Configuration/usesHumanReadableTestCaseArgumentIDs``
+    /// used to compute ``testCaseID``.
+    var usesHumanReadableTestCaseArgumentIDs: Bool
+  }
+
+  /// The failed test case to run in place of this exit test's body, if any.
+  ///
+  /// The testing library sets this property when it retries a failed test case
+  /// in a new process. For more information, see
+  /// ``Configuration/RetryPolicy/retriesInNewProcess``.
+  var retriedTestCase: RetriedTestCase?
 }
 
 #if !SWT_NO_EXIT_TESTS
@@ -385,10 +406,11 @@ extension ExitTest {
       return nil
     }
 
-    // If an exit test was found, inject back channel handling into its body.
-    // External tools authors should set up their own back channel mechanisms
-    // and ensure they're installed before calling ExitTest.callAsFunction().
-    guard var result = find(at: sourceLocation) else {
+    // If an exit test (or a retried test case) was found, inject back channel
+    // handling into its body. External tools authors should set up their own
+    // back channel mechanisms and ensure they're installed before calling
+    // ExitTest.callAsFunction().
+    guard var result = _findRetriedTestCaseInEnvironment(at: sourceLocation) ?? find(at: sourceLocation) else {
       return nil
     }
 
@@ -421,6 +443,47 @@ extension ExitTest {
     return result
   }
 
+  /// Find the failed test case specified in the environment of the current
+  /// process, if any.
+  ///
+  /// - Parameters:
+  ///   - sourceLocation: The source location of the exit test specified in the
+  ///     environment of the current process.
+  ///
+  /// - Returns: An exit test that runs the failed test case this process
+  ///   should retry, or `nil` if it is not expected to retry one.
+  private static func _findRetriedTestCaseInEnvironment(at sourceLocation: SourceLocation) -> Self? {
+    guard var retriedTestCaseString = Environment.variable(named: "SWT_EXPERIMENTAL_RETRIED_TEST_CASE") else {
+      return nil
+    }
+    let retriedTestCase = try? retriedTestCaseString.withUTF8 { retriedTestCaseBuffer in
+      let retriedTestCaseBuffer = UnsafeRawBufferPointer(retriedTestCaseBuffer)
+      return try JSON.decode(RetriedTestCase.self, from: retriedTestCaseBuffer)
+    }
+    guard let retriedTestCase else {
+      return nil
+    }
+
+    return ExitTest(expectedExitCondition: .success, body: {
+      // Run only the failed test case. Issues it records are forwarded to the
+      // parent process by the current configuration's event handler. Exit
+      // tests in the failed test case are run the same way they are when the
+      // test case is not retried.
+      var configuration = Configuration.current ?? Configuration()
+      configuration.exitTestHandler = ExitTest.handlerForEntryPoint()
+      configuration.testFilter = Configuration.TestFilter(including: [retriedTestCase.testID])
+      configuration.testCaseFilter = { testCase, _ in
+        testCase.id == retriedTestCase.testCaseID
+      }
+      configuration.usesHumanReadableTestCaseArgumentIDs = retriedTestCase.usesHumanReadableTestCaseArgumentIDs
+      await Runner(configuration: configuration).run()
+
+      // Issues are reported over the back channel rather than via the exit
+      // code, so exit successfully as long as the test case did not crash.
+      exit(EXIT_SUCCESS)
+    }, sourceLocation: sourceLocation)
+  }
+
   /// The exit test handler used when integrating with Swift Package Manager via
   /// the `__swiftPMEntryPoint()` function.
   ///
@@ -511,6 +574,15 @@ extension ExitTest {
       try JSON.withEncoding(of: exitTest.sourceLocation) { json in
         childEnvironment["SWT_EXPERIMENTAL_EXIT_TEST_SOURCE_LOCATION"] = String(decoding: json, as: UTF8.self)
       }
+      if let retriedTestCase = exitTest.retriedTestCase {
+        try JSON.withEncoding(of: retriedTestCase) { json in
+          childEnvironment["SWT_EXPERIMENTAL_RETRIED_TEST_CASE"] = String(decoding: json, as: UTF8.self)
+        }
+      } else {
+        // If this process is itself retrying a failed test case, don't let
+        // an exit test in that test case retry it again.
+        childEnvironment.removeValue(forKey: "SWT_EXPERIMENTAL_RETRIED_TEST_CASE")
+      }
 
       typealias ResultUpdater = @Sendable (inout ExitTestArtifacts) -> Void
       return try await withThrowingTaskGroup(of: ResultUpdater?.self) { taskGroup in
@@ -676,4 +748,50 @@ extension ExitTest {
     }
   }
 }
+
+// MARK: - Retrying failed test cases
+
+extension ExitTest {
+  /// Run a failed test case again in a new process.
+  ///
+  /// - Parameters:
+  ///   - testCase: The test case to run.
+  ///   - test: The test `testCase` belongs to.
+  ///   - configuration: The configuration whose exit test handler should be
+  ///     used to start the new process.
+  ///
+  /// Issues recorded by `testCase` in the new process are recorded again in the
+  /// current process. If the new process does not exit successfully (for
+  /// example, because `testCase` crashed), an additional issue is recorded.
+  static func retry(_ testCase: Test.Case, of test: Test, configuration: Configuration) async {
+    var exitTest = ExitTest(expectedExitCondition: .success, sourceLocation: test.sourceLocation)
+    exitTest.retriedTestCase = RetriedTestCase(
+      testID: test.id,
+      testCaseID: testCase.id,
+      usesHumanReadableTestCaseArgumentIDs: configuration.usesHumanReadableTestCaseArgumentIDs
+    )
+
+    let issue: Issue
+    do {
+      let result = try await configuration.exitTestHandler(exitTest)
+      if result.exitCondition == .success {
+        return
+      }
+      issue = Issue(
+        kind: .unconditional,
+        comments: ["Test case exited with \(String(describingForTest: result.exitCondition)) while being retried in a new process"],
+        sourceContext: SourceContext(backtrace: nil, sourceLocation: test.sourceLocation)
+      )
+    } catch {
+      // As with other exit tests, a failure to start the new process is a
+      // system issue rather than a test issue.
+      issue = Issue(
+        kind: .system,
+        comments: [Comment(rawValue: String(describingForTest: error))],
+        sourceContext: SourceContext(backtrace: Backtrace(forFirstThrowOf: error), sourceLocation: test.sourceLocation)
+      )
+    }
+    issue.record(configuration: configuration)
+  }
+}
 #endif
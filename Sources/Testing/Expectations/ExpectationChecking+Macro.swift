@@ -83,6 +83,66 @@ public func __checkValue(
     }
   }
 
+  // Early exit if the expectation passed and nothing is listening for passing
+  // expectations. This is by far the most common path through this function,
+  // so avoid constructing an expectation, capturing a backtrace, or looking up
+  // the current configuration here.
+  if _fastPath(condition) && !Configuration.deliverExpectationCheckedEvents {
+    if Configuration.countExpectationsChecked {
+      Event.ExpectationCounts.count(isPassing: true)
+    }
+    return .success(())
+  }
+
+  return _checkValueSlowPath(
+    condition,
+    expression: expression,
+    expressionWithCapturedRuntimeValues: expressionWithCapturedRuntimeValues(),
+    mismatchedErrorDescription: mismatchedErrorDescription(),
+    difference: difference(),
+    mismatchedExitConditionDescription: mismatchedExitConditionDescription(),
+    comments: comments(),
+    isRequired: isRequired,
+    sourceLocation: sourceLocation
+  )
+}
+
+/// Post an event for an expectation and, if it failed, record an issue.
+///
+/// - Parameters:
+///   - condition: The condition that was evaluated, with any negations in
+///     `expression` already applied.
+///   - expression: The expression, corresponding to `condition`, that is being
+///     evaluated (if available at compile time.)
+///   - expressionWithCapturedRuntimeValues: The expression, corresponding to
+///     `condition` and with runtime values captured, that is being evaluated
+///     (if available at compile time.)
+///   - difference: The difference between the operands in `condition`, if
+///     available.
+///   - comments: An array of comments describing the expectation. This array
+///     may be empty.
+///   - isRequired: Whether or not the expectation is required.
+///   - sourceLocation: The source location of the expectation.
+///
+/// - Returns: A `Result<Void, any Error>`. If `condition` is `true`, the result
+///   is `.success`. If `condition` is `false`, the result is an instance of
+///   ``ExpectationFailedError`` describing the failure.
+///
+/// This function implements the uncommon paths through `__checkValue()` and is
+/// kept out of line so that the common path (a passing expectation that no
+/// event handler is interested in) stays small.
+@inline(never)
+private func _checkValueSlowPath(
+  _ condition: Bool,
+  expression: __Expression,
+  expressionWithCapturedRuntimeValues: @autoclosure () -> __Expression?,
+  mismatchedErrorDescription: @autoclosure () -> String?,
+  difference: @autoclosure () -> String?,
+  mismatchedExitConditionDescription: @autoclosure () -> String?,
+  comments: @autoclosure () -> [Comment],
+  isRequired: Bool,
+  sourceLocation: SourceLocation
+) -> Result<Void, any Error> {
   // Capture the correct expression in the expectation.
   var expression = expression
   if !condition, let expressionWithCapturedRuntimeValues = expressionWithCapturedRuntimeValues() {
@@ -99,6 +159,9 @@ public func __checkValue(
   if Configuration.deliverExpectationCheckedEvents {
     Event.post(.expectationChecked(expectation))
   }
+  if Configuration.countExpectationsChecked {
+    Event.ExpectationCounts.count(isPassing: condition)
+  }
 
   // Early exit if the expectation passed.
   if condition {
@@ -608,19 +671,7 @@ public func __checkPropertyAccess<T, U>(
     guard let rhs else {
       return nil
     }
-    let difference = lhs.difference(from: rhs)
-    let insertions = difference.insertions.map(\.element)
-    let removals = difference.removals.map(\.element)
-    switch (!insertions.isEmpty, !removals.isEmpty) {
-    case (true, true):
-      return "inserted \(insertions), removed \(removals)"
-    case (true, false):
-      return "inserted \(insertions)"
-    case (false, true):
-      return "removed \(removals)"
-    case (false, false):
-      return ""
-    }
+    return lhs.differenceDescription(from: rhs)
   }
 
   return __checkValue(
@@ -1047,7 +1098,7 @@ public func __checkClosureCall<R>(
 ) -> Result<Void, any Error> {
   var errorMatches = false
   var mismatchExplanationValue: String? = nil
-  var expression = expression
+  var thrownError: (any Error)?
   do {
     let result = try body()
 
@@ -1057,7 +1108,7 @@ public func __checkClosureCall<R>(
     }
     mismatchExplanationValue = explanation
   } catch {
-    expression = expression.capturingRuntimeValues(error)
+    thrownError = error
     let secondError = Issue.withErrorRecording(at: sourceLocation) {
       errorMatches = try errorMatcher(error)
     }
@@ -1068,9 +1119,12 @@ public func __checkClosureCall<R>(
     }
   }
 
+  // Only reflect the thrown error if the expectation fails so that passing
+  // expectations do not pay the cost of reflection.
   return __checkValue(
     errorMatches,
     expression: expression,
+    expressionWithCapturedRuntimeValues: thrownError.map { expression.capturingRuntimeValues($0) },
     mismatchedErrorDescription: mismatchExplanationValue,
     comments: comments(),
     isRequired: isRequired,
@@ -1096,7 +1150,7 @@ public func __checkClosureCall<R>(
 ) async -> Result<Void, any Error> {
   var errorMatches = false
   var mismatchExplanationValue: String? = nil
-  var expression = expression
+  var thrownError: (any Error)?
   do {
     let result = try await body()
 
@@ -1106,7 +1160,7 @@ public func __checkClosureCall<R>(
     }
     mismatchExplanationValue = explanation
   } catch {
-    expression = expression.capturingRuntimeValues(error)
+    thrownError = error
     let secondError = await Issue.withErrorRecording(at: sourceLocation) {
       errorMatches = try await errorMatcher(error)
     }
@@ -1117,9 +1171,12 @@ public func __checkClosureCall<R>(
     }
   }
 
+  // Only reflect the thrown error if the expectation fails so that passing
+  // expectations do not pay the cost of reflection.
   return __checkValue(
     errorMatches,
     expression: expression,
+    expressionWithCapturedRuntimeValues: thrownError.map { expression.capturingRuntimeValues($0) },
     mismatchedErrorDescription: mismatchExplanationValue,
     comments: comments(),
     isRequired: isRequired,
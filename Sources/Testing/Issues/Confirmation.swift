@@ -14,7 +14,7 @@ public struct Confirmation: Sendable {
   ///
   /// This property is fileprivate because it may be mutated asynchronously and
   /// callers may be tempted to use it in ways that result in data races.
-  fileprivate var count = Locked(rawValue: 0)
+  fileprivate var count = AtomicCounter(rawValue: 0)
 
   /// Confirm this confirmation.
   ///
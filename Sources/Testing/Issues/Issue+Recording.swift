@@ -47,6 +47,8 @@ extension Issue {
     Event.post(.issueRecorded(self), configuration: configuration)
 
     if !isKnown {
+      Self.noteUnknownIssueRecorded()
+
       // Since this is not a known issue, invoke the failure breakpoint.
       //
       // Do this after posting the event above, to allow the issue to be printed
@@ -57,6 +57,29 @@ public struct Issue: Sendable {
     /// }
     indirect case timeLimitExceeded(timeLimitComponents: (seconds: Int64, attoseconds: Int64))
 
+    /// An issue due to a test case running significantly slower than its
+    /// performance baseline.
+    ///
+    /// - Parameters:
+    ///   - regression: A description of the regression.
+    ///
+    /// Issues of this kind are only recorded when
+    /// ``Configuration/performanceBaselines`` is set.
+    @_spi(Experimental)
+    indirect case performanceRegressed(_ regression: PerformanceBaselines.Regression)
+
+    /// An issue due to a test case making more heap allocations than its
+    /// allocation budget allows.
+    ///
+    /// - Parameters:
+    ///   - allocationCounts: The allocations made by the test case.
+    ///   - budget: The allocation budget that was exceeded.
+    ///
+    /// Issues of this kind are only recorded for tests with an
+    /// ``AllocationBudgetTrait``.
+    @_spi(Experimental)
+    indirect case allocationBudgetExceeded(_ allocationCounts: Event.AllocationCounts, budget: AllocationBudgetTrait)
+
     /// A known issue was expected, but was not recorded.
     case knownIssueNotRecorded
 
@@ -85,6 +108,15 @@ public struct Issue: Sendable {
   @_spi(ForToolsIntegrationOnly)
   public var isKnown = false
 
+  /// The backtraces of the other threads in the process when this issue
+  /// occurred, if they were captured.
+  ///
+  /// The testing library captures these backtraces when a test exceeds its
+  /// time limit, on platforms that support doing so. For more information, see
+  /// ``Kind-swift.enum/timeLimitExceeded(timeLimitComponents:)``.
+  @_spi(Experimental) @_spi(ForToolsIntegrationOnly)
+  public var threadBacktraces: [Backtrace]?
+
   /// Initialize an issue instance with the specified details.
   ///
   /// - Parameters:
@@ -210,6 +242,12 @@ extension Issue.Kind: CustomStringConvertible {
       return "Caught error: \(error)"
     case let .timeLimitExceeded(timeLimitComponents: timeLimitComponents):
       return "Time limit was exceeded: \(TimeValue(timeLimitComponents))"
+    case let .performanceRegressed(regression):
+      let duration = BenchmarkTrait.Statistics.descriptionOfNanoseconds(Double(regression.nanoseconds))
+      let baselineDuration = BenchmarkTrait.Statistics.descriptionOfNanoseconds(Double(regression.baselineMedianNanoseconds))
+      return "Performance regressed: took \(duration), but the median of \(regression.baselineSampleCount.counting("baseline sample")) is \(baselineDuration)"
+    case let .allocationBudgetExceeded(allocationCounts, budget):
+      return "Allocation budget was exceeded: made \(allocationCounts.allocationCount.counting("allocation")) totaling \(allocationCounts.allocatedByteCount.counting("byte")), but the budget allows \(budget.summary)"
     case .knownIssueNotRecorded:
       return "Known issue was not recorded"
     case .apiMisused:
@@ -242,6 +280,11 @@ extension Issue {
     /// Whether or not this issue is known to occur.
     public var isKnown = false
 
+    /// The backtraces of the other threads in the process when this issue
+    /// occurred, if they were captured.
+    @_spi(Experimental)
+    public var threadBacktraces: [Backtrace]?
+
     /// Initialize an issue instance with the specified details.
     ///
     /// - Parameter issue: The original issue that gets snapshotted.
@@ -256,6 +299,7 @@ extension Issue {
       }
       self.sourceContext = issue.sourceContext
       self.isKnown = issue.isKnown
+      self.threadBacktraces = issue.threadBacktraces
     }
 
     /// The error which was associated with this issue, if any.
@@ -331,6 +375,23 @@ extension Issue.Kind {
     /// }
     indirect case timeLimitExceeded(timeLimitComponents: (seconds: Int64, attoseconds: Int64))
 
+    /// An issue due to a test case running significantly slower than its
+    /// performance baseline.
+    ///
+    /// - Parameters:
+    ///   - regression: A description of the regression.
+    @_spi(Experimental)
+    indirect case performanceRegressed(_ regression: PerformanceBaselines.Regression)
+
+    /// An issue due to a test case making more heap allocations than its
+    /// allocation budget allows.
+    ///
+    /// - Parameters:
+    ///   - allocationCounts: The allocations made by the test case.
+    ///   - budget: The allocation budget that was exceeded.
+    @_spi(Experimental)
+    indirect case allocationBudgetExceeded(_ allocationCounts: Event.AllocationCounts, budget: AllocationBudgetTrait)
+
     /// A known issue was expected, but was not recorded.
     case knownIssueNotRecorded
 
@@ -355,6 +416,10 @@ extension Issue.Kind {
           .errorCaught(ErrorSnapshot(snapshotting: error))
       case let .timeLimitExceeded(timeLimitComponents: timeLimitComponents):
           .timeLimitExceeded(timeLimitComponents: timeLimitComponents)
+      case let .performanceRegressed(regression):
+          .performanceRegressed(regression)
+      case let .allocationBudgetExceeded(allocationCounts, budget):
+          .allocationBudgetExceeded(allocationCounts, budget: budget)
       case .knownIssueNotRecorded:
           .knownIssueNotRecorded
       case .apiMisused:
@@ -371,6 +436,8 @@ extension Issue.Kind {
       case confirmationMiscounted
       case errorCaught
       case timeLimitExceeded
+      case performanceRegressed
+      case allocationBudgetExceeded
       case knownIssueNotRecorded
       case apiMisused
       case system
@@ -390,6 +457,12 @@ extension Issue.Kind {
       enum _ErrorCaughtKeys: CodingKey {
         case error
       }
+
+      /// The keys used to encode ``Issue.Kind.allocationBudgetExceeded``.
+      enum _AllocationBudgetExceededKeys: CodingKey {
+        case allocationCounts
+        case budget
+      }
     }
 
     public init(from decoder: any Decoder) throws {
@@ -410,6 +483,12 @@ extension Issue.Kind {
         self = .errorCaught(try errorCaught.decode(ErrorSnapshot.self, forKey: .error))
       } else if let timeLimit = try container.decodeIfPresent(TimeValue.self, forKey: .timeLimitExceeded) {
         self = .timeLimitExceeded(timeLimitComponents: timeLimit.components)
+      } else if let regression = try container.decodeIfPresent(PerformanceBaselines.Regression.self, forKey: .performanceRegressed) {
+        self = .performanceRegressed(regression)
+      } else if let allocationBudgetExceeded = try? container.nestedContainer(keyedBy: _CodingKeys._AllocationBudgetExceededKeys.self,
+                                                                              forKey: .allocationBudgetExceeded) {
+        self = .allocationBudgetExceeded(try allocationBudgetExceeded.decode(Event.AllocationCounts.self, forKey: .allocationCounts),
+                                         budget: try allocationBudgetExceeded.decode(AllocationBudgetTrait.self, forKey: .budget))
       } else if try container.decodeIfPresent(Bool.self, forKey: .knownIssueNotRecorded) != nil {
         self = .knownIssueNotRecorded
       } else if try container.decodeIfPresent(Bool.self, forKey: .apiMisused) != nil {
@@ -446,6 +525,13 @@ extension Issue.Kind {
         try errorCaughtContainer.encode(error, forKey: .error)
       case let .timeLimitExceeded(timeLimitComponents):
         try container.encode(TimeValue(timeLimitComponents), forKey: .timeLimitExceeded)
+      case let .performanceRegressed(regression):
+        try container.encode(regression, forKey: .performanceRegressed)
+      case let .allocationBudgetExceeded(allocationCounts, budget):
+        var allocationBudgetExceededContainer = container.nestedContainer(keyedBy: _CodingKeys._AllocationBudgetExceededKeys.self,
+                                                                          forKey: .allocationBudgetExceeded)
+        try allocationBudgetExceededContainer.encode(allocationCounts, forKey: .allocationCounts)
+        try allocationBudgetExceededContainer.encode(budget, forKey: .budget)
       case .knownIssueNotRecorded:
         try container.encode(true, forKey: .knownIssueNotRecorded)
       case .apiMisused:
@@ -498,6 +584,10 @@ extension Issue.Kind.Snapshot: CustomStringConvertible {
       "Caught error: \(error)"
     case let .timeLimitExceeded(timeLimitComponents: timeLimitComponents):
       "Time limit was exceeded: \(TimeValue(timeLimitComponents))"
+    case let .performanceRegressed(regression):
+      String(describing: Issue.Kind.performanceRegressed(regression))
+    case let .allocationBudgetExceeded(allocationCounts, budget):
+      String(describing: Issue.Kind.allocationBudgetExceeded(allocationCounts, budget: budget))
     case .knownIssueNotRecorded:
       "Known issue was not recorded"
     case .apiMisused:
@@ -18,7 +18,7 @@
 ///
 /// - Returns: A new instance of ``Configuration`` or `nil` if there was no
 ///   current configuration set.
-private func _combineIssueMatcher(_ issueMatcher: @escaping KnownIssueMatcher, matchesCountedBy matchCounter: Locked<Int>) -> KnownIssueMatcher {
+private func _combineIssueMatcher(_ issueMatcher: @escaping KnownIssueMatcher, matchesCountedBy matchCounter: AtomicCounter) -> KnownIssueMatcher {
   let oldIssueMatcher = Issue.currentKnownIssueMatcher
   return { issue in
     if issueMatcher(issue) || true == oldIssueMatcher?(issue) {
@@ -63,7 +63,7 @@ private func _matchError(_ error: any Error, using issueMatcher: KnownIssueMatch
 ///     function.
 ///   - sourceLocation: The source location to which the issue should be
 ///     attributed.
-private func _handleMiscount(by matchCounter: Locked<Int>, comment: Comment?, sourceLocation: SourceLocation) {
+private func _handleMiscount(by matchCounter: AtomicCounter, comment: Comment?, sourceLocation: SourceLocation) {
   if matchCounter.rawValue == 0 {
     let issue = Issue(
       kind: .knownIssueNotRecorded,
@@ -176,7 +176,7 @@ public func withKnownIssue(
   guard precondition() else {
     return try body()
   }
-  let matchCounter = Locked(rawValue: 0)
+  let matchCounter = AtomicCounter(rawValue: 0)
   let issueMatcher = _combineIssueMatcher(issueMatcher, matchesCountedBy: matchCounter)
   defer {
     if !isIntermittent {
@@ -288,7 +288,7 @@ public func withKnownIssue(
   guard await precondition() else {
     return try await body()
   }
-  let matchCounter = Locked(rawValue: 0)
+  let matchCounter = AtomicCounter(rawValue: 0)
   let issueMatcher = _combineIssueMatcher(issueMatcher, matchesCountedBy: matchCounter)
   defer {
     if !isIntermittent {
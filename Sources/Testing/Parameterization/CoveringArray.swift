@@ -0,0 +1,439 @@
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for Swift project authors
+//
+
+/// A type describing a [covering array](https://en.wikipedia.org/wiki/Covering_array)
+/// over a set of parameters with known numbers of values.
+///
+/// A covering array of strength _t_ is a list of rows, each of which assigns
+/// one value to every parameter, such that for every choice of _t_ parameters,
+/// every combination of their values appears in at least one row. A covering
+/// array of strength 2 (a _pairwise_ covering array) over ten parameters with
+/// ten values each has on the order of 150 rows, while the Cartesian product
+/// of the same parameters has ten billion.
+///
+/// Rows are built greedily, one at a time: several candidate rows are
+/// constructed, each seeded with a combination not yet covered and completed
+/// by picking whichever value for each remaining parameter covers the most new
+/// combinations, and the candidate covering the most new combinations is kept.
+/// The result is not guaranteed to be minimal, but is typically close to it.
+/// Candidate construction is randomized using a generator seeded with a
+/// caller-supplied value, so the same inputs and seed always produce the same
+/// rows.
+///
+/// This type is not part of the public interface of the testing library.
+struct CoveringArray: Sendable {
+  /// The rows of this covering array.
+  ///
+  /// Each row contains one value index per parameter, in the same order as
+  /// the value counts passed to ``init(valueCounts:strength:seed:)``.
+  private(set) var rows = [[Int]]()
+
+  /// A type describing one combination of parameters whose value combinations
+  /// must all be covered.
+  private struct _Group {
+    /// The indices of the parameters in this group, in ascending order.
+    var parameters: [Int]
+
+    /// The mixed-radix stride of each parameter in ``parameters``.
+    var strides: [Int]
+
+    /// Whether or not each combination of values of ``parameters`` has been
+    /// covered.
+    var isCovered: [Bool]
+
+    /// The number of elements of ``isCovered`` that are `false`.
+    var uncoveredCount: Int
+
+    init(parameters: [Int], valueCounts: [Int]) {
+      self.parameters = parameters
+      var strides = [Int]()
+      var combinationCount = 1
+      for parameter in parameters {
+        strides.append(combinationCount)
+        combinationCount *= valueCounts[parameter]
+      }
+      self.strides = strides
+      isCovered = Array(repeating: false, count: combinationCount)
+      uncoveredCount = combinationCount
+    }
+
+    /// Get the index into ``isCovered`` of the combination of values in a row.
+    ///
+    /// - Parameters:
+    ///   - row: The row. Every parameter in this group must have a value in
+    ///     `row`.
+    ///
+    /// - Returns: The index of the combination of values in `row`.
+    func index(in row: [Int]) -> Int {
+      zip(parameters, strides).reduce(into: 0) { result, parameterAndStride in
+        result += row[parameterAndStride.0] * parameterAndStride.1
+      }
+    }
+  }
+
+  /// The number of candidate rows to construct before choosing the row to add.
+  private static let _candidateCount = 16
+
+  /// A value in a row under construction representing a parameter that has
+  /// not been assigned a value yet.
+  private static let _unassigned = -1
+
+  /// Initialize an instance of this type.
+  ///
+  /// - Parameters:
+  ///   - valueCounts: The number of values of each parameter.
+  ///   - strength: The number of parameters whose value combinations must all
+  ///     be covered. If this value is greater than or equal to the number of
+  ///     parameters, the result is equivalent to the Cartesian product of the
+  ///     parameters' values.
+  ///   - seed: A value used to seed candidate construction.
+  ///
+  /// If any parameter has no values, the resulting covering array has no rows.
+  init(valueCounts: [Int], strength: Int, seed: UInt64) {
+    precondition(strength > 0, "The strength of a covering array must be greater than 0.")
+    if valueCounts.isEmpty || valueCounts.contains(0) {
+      return
+    }
+    let strength = min(strength, valueCounts.count)
+
+    var groups = Self._combinations(of: strength, from: valueCounts.indices).map { parameters in
+      _Group(parameters: parameters, valueCounts: valueCounts)
+    }
+    var groupIndicesByParameter = [[Int]](repeating: [], count: valueCounts.count)
+    for (groupIndex, group) in groups.enumerated() {
+      for parameter in group.parameters {
+        groupIndicesByParameter[parameter].append(groupIndex)
+      }
+    }
+    var uncoveredCount = groups.reduce(0) { $0 + $1.uncoveredCount }
+
+    var rng = _SplitMix64(seed: seed)
+    while uncoveredCount > 0 {
+      // Always seed candidates from the first group that still has uncovered
+      // combinations so that every row makes progress.
+      let seedGroup = groups.first { $0.uncoveredCount > 0 }!
+
+      var bestRow = [Int]()
+      var bestGain = 0
+      for _ in 0 ..< Self._candidateCount {
+        var row = Self._candidate(
+          seededFrom: seedGroup,
+          valueCounts: valueCounts,
+          groups: groups,
+          groupIndicesByParameter: groupIndicesByParameter,
+          using: &rng
+        )
+        let gain = groups.lazy.filter { !$0.isCovered[$0.index(in: row)] }.count
+        if gain > bestGain {
+          swap(&bestRow, &row)
+          bestGain = gain
+        }
+      }
+
+      for groupIndex in groups.indices {
+        let index = groups[groupIndex].index(in: bestRow)
+        if !groups[groupIndex].isCovered[index] {
+          groups[groupIndex].isCovered[index] = true
+          groups[groupIndex].uncoveredCount -= 1
+        }
+      }
+      uncoveredCount -= bestGain
+      rows.append(bestRow)
+    }
+  }
+
+  /// Construct a candidate row.
+  ///
+  /// - Parameters:
+  ///   - seedGroup: A group with at least one uncovered combination. The
+  ///     candidate row contains one such combination.
+  ///   - valueCounts: The number of values of each parameter.
+  ///   - groups: All groups of parameters.
+  ///   - groupIndicesByParameter: The indices in `groups` of the groups
+  ///     containing each parameter.
+  ///   - rng: The random number generator to use.
+  ///
+  /// - Returns: A row assigning a value to every parameter.
+  private static func _candidate(
+    seededFrom seedGroup: _Group,
+    valueCounts: [Int],
+    groups: [_Group],
+    groupIndicesByParameter: [[Int]],
+    using rng: inout some RandomNumberGenerator
+  ) -> [Int] {
+    var row = [Int](repeating: _unassigned, count: valueCounts.count)
+
+    // Start from a random uncovered combination in the seed group.
+    let combinationCount = seedGroup.isCovered.count
+    let offset = Int.random(in: 0 ..< combinationCount, using: &rng)
+    var combination = (0 ..< combinationCount).lazy
+      .map { ($0 + offset) % combinationCount }
+      .first { !seedGroup.isCovered[$0] }!
+    for (parameter, stride) in zip(seedGroup.parameters, seedGroup.strides).reversed() {
+      row[parameter] = combination / stride
+      combination %= stride
+    }
+
+    // Assign the remaining parameters in a random order, greedily picking the
+    // value that completes the most uncovered combinations. Values are
+    // considered from a random starting point so that ties are broken
+    // differently by each candidate.
+    let remainingParameters = valueCounts.indices.filter { row[$0] == _unassigned }.shuffled(using: &rng)
+    for parameter in remainingParameters {
+      let valueCount = valueCounts[parameter]
+      let firstValue = Int.random(in: 0 ..< valueCount, using: &rng)
+      var bestValue = firstValue
+      var bestGain = -1
+      for value in (0 ..< valueCount).lazy.map({ ($0 + firstValue) % valueCount }) {
+        row[parameter] = value
+        let gain = groupIndicesByParameter[parameter].lazy
+          .map { groups[$0] }
+          .filter { group in group.parameters.allSatisfy { row[$0] != _unassigned } }
+          .filter { !$0.isCovered[$0.index(in: row)] }
+          .count
+        if gain > bestGain {
+          bestValue = value
+          bestGain = gain
+        }
+      }
+      row[parameter] = bestValue
+    }
+
+    return row
+  }
+
+  /// Get all combinations of a given size from a range of integers.
+  ///
+  /// - Parameters:
+  ///   - size: The number of integers in each combination.
+  ///   - range: The integers to combine.
+  ///
+  /// - Returns: Every combination of `size` integers from `range`, each sorted
+  ///   in ascending order.
+  private static func _combinations(of size: Int, from range: Range<Int>) -> [[Int]] {
+    if size == 0 {
+      return [[]]
+    }
+    return range.flatMap { first in
+      _combinations(of: size - 1, from: (first + 1) ..< range.upperBound).map { rest in
+        [first] + rest
+      }
+    }
+  }
+}
+
+// MARK: - Random number generation
+
+/// A deterministic random number generator implementing the
+/// [SplitMix64](https://prng.di.unimi.it/splitmix64.c) algorithm.
+///
+/// The system random number generator cannot be seeded, so this generator is
+/// used wherever the testing library needs reproducible randomness.
+private struct _SplitMix64: RandomNumberGenerator {
+  /// The current state of the generator.
+  private var _state: UInt64
+
+  init(seed: UInt64) {
+    _state = seed
+  }
+
+  mutating func next() -> UInt64 {
+    _state &+= 0x9E3779B97F4A7C15
+    var result = _state
+    result = (result ^ (result >> 30)) &* 0xBF58476D1CE4E5B9
+    result = (result ^ (result >> 27)) &* 0x94D049BB133111EB
+    return result ^ (result >> 31)
+  }
+}
+
+// MARK: - Public interface
+
+/// Create a pairwise covering array of the elements of three collections.
+///
+/// - Parameters:
+///   - collection1: The first collection of argument values.
+///   - collection2: The second collection of argument values.
+///   - collection3: The third collection of argument values.
+///   - seed: A value used to seed the generation of the covering array. The
+///     same collections and seed always produce the same result.
+///
+/// - Returns: An array of tuples of type
+///   `(C1.Element, C2.Element, C3.Element)` in which every pair of elements
+///   drawn from any two of the input collections appears at least once.
+///
+/// Use this function to test every interaction between pairs of arguments
+/// without testing every combination of arguments:
+///
+/// ```swift
+/// @Test(arguments: pairwise(Food.allCases, Temperature.allCases, Plate.allCases))
+/// func serve(_ food: Food, at temperature: Temperature, on plate: Plate) {
+///   ...
+/// }
+/// ```
+///
+/// The number of test cases generated grows roughly with the product of the
+/// sizes of the two largest collections, rather than with the product of the
+/// sizes of all of them. To cover combinations of more than two arguments at a
+/// time, use ``nWise(_:_:_:_:seed:)`` instead.
+@_spi(Experimental)
+public func pairwise<C1, C2, C3>(
+  _ collection1: C1, _ collection2: C2, _ collection3: C3,
+  seed: UInt64 = 0
+) -> [(C1.Element, C2.Element, C3.Element)] where C1: Collection, C2: Collection, C3: Collection {
+  nWise(2, collection1, collection2, collection3, seed: seed)
+}
+
+/// Create a pairwise covering array of the elements of four collections.
+///
+/// - Parameters:
+///   - collection1: The first collection of argument values.
+///   - collection2: The second collection of argument values.
+///   - collection3: The third collection of argument values.
+///   - collection4: The fourth collection of argument values.
+///   - seed: A value used to seed the generation of the covering array. The
+///     same collections and seed always produce the same result.
+///
+/// - Returns: An array of tuples of type
+///   `(C1.Element, C2.Element, C3.Element, C4.Element)` in which every pair of
+///   elements drawn from any two of the input collections appears at least
+///   once.
+///
+/// For more information, see ``pairwise(_:_:_:seed:)``.
+@_spi(Experimental)
+public func pairwise<C1, C2, C3, C4>(
+  _ collection1: C1, _ collection2: C2, _ collection3: C3, _ collection4: C4,
+  seed: UInt64 = 0
+) -> [(C1.Element, C2.Element, C3.Element, C4.Element)] where C1: Collection, C2: Collection, C3: Collection, C4: Collection {
+  nWise(2, collection1, collection2, collection3, collection4, seed: seed)
+}
+
+/// Create a pairwise covering array of the elements of five collections.
+///
+/// - Parameters:
+///   - collection1: The first collection of argument values.
+///   - collection2: The second collection of argument values.
+///   - collection3: The third collection of argument values.
+///   - collection4: The fourth collection of argument values.
+///   - collection5: The fifth collection of argument values.
+///   - seed: A value used to seed the generation of the covering array. The
+///     same collections and seed always produce the same result.
+///
+/// - Returns: An array of tuples of type
+///   `(C1.Element, C2.Element, C3.Element, C4.Element, C5.Element)` in which
+///   every pair of elements drawn from any two of the input collections
+///   appears at least once.
+///
+/// For more information, see ``pairwise(_:_:_:seed:)``.
+@_spi(Experimental)
+public func pairwise<C1, C2, C3, C4, C5>(
+  _ collection1: C1, _ collection2: C2, _ collection3: C3, _ collection4: C4, _ collection5: C5,
+  seed: UInt64 = 0
+) -> [(C1.Element, C2.Element, C3.Element, C4.Element, C5.Element)] where C1: Collection, C2: Collection, C3: Collection, C4: Collection, C5: Collection {
+  nWise(2, collection1, collection2, collection3, collection4, collection5, seed: seed)
+}
+
+/// Create a covering array of the elements of three collections.
+///
+/// - Parameters:
+///   - strength: The number of collections whose element combinations must
+///     all be covered. If this value is `3`, the result contains every
+///     combination of the input collections' elements.
+///   - collection1: The first collection of argument values.
+///   - collection2: The second collection of argument values.
+///   - collection3: The third collection of argument values.
+///   - seed: A value used to seed the generation of the covering array. The
+///     same collections and seed always produce the same result.
+///
+/// - Returns: An array of tuples of type
+///   `(C1.Element, C2.Element, C3.Element)` in which every combination of
+///   elements drawn from any `strength` of the input collections appears at
+///   least once.
+///
+/// - Precondition: `strength` must be greater than `0`.
+///
+/// For more information, see ``pairwise(_:_:_:seed:)``.
+@_spi(Experimental)
+public func nWise<C1, C2, C3>(
+  _ strength: Int,
+  _ collection1: C1, _ collection2: C2, _ collection3: C3,
+  seed: UInt64 = 0
+) -> [(C1.Element, C2.Element, C3.Element)] where C1: Collection, C2: Collection, C3: Collection {
+  let (a1, a2, a3) = (Array(collection1), Array(collection2), Array(collection3))
+  return CoveringArray(valueCounts: [a1.count, a2.count, a3.count], strength: strength, seed: seed).rows.map { row in
+    (a1[row[0]], a2[row[1]], a3[row[2]])
+  }
+}
+
+/// Create a covering array of the elements of four collections.
+///
+/// - Parameters:
+///   - strength: The number of collections whose element combinations must
+///     all be covered. If this value is `4`, the result contains every
+///     combination of the input collections' elements.
+///   - collection1: The first collection of argument values.
+///   - collection2: The second collection of argument values.
+///   - collection3: The third collection of argument values.
+///   - collection4: The fourth collection of argument values.
+///   - seed: A value used to seed the generation of the covering array. The
+///     same collections and seed always produce the same result.
+///
+/// - Returns: An array of tuples of type
+///   `(C1.Element, C2.Element, C3.Element, C4.Element)` in which every
+///   combination of elements drawn from any `strength` of the input
+///   collections appears at least once.
+///
+/// - Precondition: `strength` must be greater than `0`.
+///
+/// For more information, see ``pairwise(_:_:_:seed:)``.
+@_spi(Experimental)
+public func nWise<C1, C2, C3, C4>(
+  _ strength: Int,
+  _ collection1: C1, _ collection2: C2, _ collection3: C3, _ collection4: C4,
+  seed: UInt64 = 0
+) -> [(C1.Element, C2.Element, C3.Element, C4.Element)] where C1: Collection, C2: Collection, C3: Collection, C4: Collection {
+  let (a1, a2, a3, a4) = (Array(collection1), Array(collection2), Array(collection3), Array(collection4))
+  return CoveringArray(valueCounts: [a1.count, a2.count, a3.count, a4.count], strength: strength, seed: seed).rows.map { row in
+    (a1[row[0]], a2[row[1]], a3[row[2]], a4[row[3]])
+  }
+}
+
+/// Create a covering array of the elements of five collections.
+///
+/// - Parameters:
+///   - strength: The number of collections whose element combinations must
+///     all be covered. If this value is `5`, the result contains every
+///     combination of the input collections' elements.
+///   - collection1: The first collection of argument values.
+///   - collection2: The second collection of argument values.
+///   - collection3: The third collection of argument values.
+///   - collection4: The fourth collection of argument values.
+///   - collection5: The fifth collection of argument values.
+///   - seed: A value used to seed the generation of the covering array. The
+///     same collections and seed always produce the same result.
+///
+/// - Returns: An array of tuples of type
+///   `(C1.Element, C2.Element, C3.Element, C4.Element, C5.Element)` in which
+///   every combination of elements drawn from any `strength` of the input
+///   collections appears at least once.
+///
+/// - Precondition: `strength` must be greater than `0`.
+///
+/// For more information, see ``pairwise(_:_:_:seed:)``.
+@_spi(Experimental)
+public func nWise<C1, C2, C3, C4, C5>(
+  _ strength: Int,
+  _ collection1: C1, _ collection2: C2, _ collection3: C3, _ collection4: C4, _ collection5: C5,
+  seed: UInt64 = 0
+) -> [(C1.Element, C2.Element, C3.Element, C4.Element, C5.Element)] where C1: Collection, C2: Collection, C3: Collection, C4: Collection, C5: Collection {
+  let (a1, a2, a3, a4, a5) = (Array(collection1), Array(collection2), Array(collection3), Array(collection4), Array(collection5))
+  return CoveringArray(valueCounts: [a1.count, a2.count, a3.count, a4.count, a5.count], strength: strength, seed: seed).rows.map { row in
+    (a1[row[0]], a2[row[1]], a3[row[2]], a4[row[3]], a5[row[4]])
+  }
+}
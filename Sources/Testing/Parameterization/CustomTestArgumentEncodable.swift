@@ -50,6 +50,9 @@ extension Test.Case.Argument.ID {
   ///   - value: The value of a test argument for which to get an ID.
   ///   - parameter: The parameter of the test function to which this argument
   ///     value was passed.
+  ///   - isHumanReadable: Whether the resulting ID must contain a decodable,
+  ///     human-readable (JSON) representation of `value`. If `false`, the
+  ///     resulting ID instead contains a compact, stable hash of `value`.
   ///
   /// - Returns: `nil` if an ID cannot be formed from the specified test
   ///   argument value.
@@ -61,8 +64,8 @@ extension Test.Case.Argument.ID {
   /// ## See Also
   ///
   /// - ``CustomTestArgumentEncodable``
-  init?(identifying value: some Sendable, parameter: Test.Parameter) throws {
-#if canImport(Foundation)
+  /// - ``Configuration/usesHumanReadableTestCaseArgumentIDs``
+  init?(identifying value: some Sendable, parameter: Test.Parameter, isHumanReadable: Bool = true) throws {
     func customArgumentWrapper(for value: some CustomTestArgumentEncodable) -> some Encodable {
       _CustomArgumentWrapper(rawValue: value)
     }
@@ -83,9 +86,15 @@ extension Test.Case.Argument.ID {
       return nil
     }
 
+    if !isHumanReadable {
+      self = .init(bytes: try StableHashingEncoder.hash(of: encodableValue, userInfo: [._testParameterUserInfoKey: parameter]))
+      return
+    }
+
+#if canImport(Foundation)
     self = .init(bytes: try Self._encode(encodableValue, parameter: parameter))
 #else
-    nil
+    return nil
 #endif
   }
 
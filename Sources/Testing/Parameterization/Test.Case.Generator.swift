@@ -264,3 +264,41 @@ extension Test.Case.Generator: Sequence {
     _sequence.underestimatedCount
   }
 }
+
+// MARK: - Collection
+
+/// When the underlying sequence of argument values supports random access
+/// (for instance, an array or the ``CartesianProduct`` of two arrays), the
+/// test case at any position can be generated directly without generating
+/// the test cases that precede it.
+extension Test.Case.Generator: Collection, BidirectionalCollection, RandomAccessCollection where S: RandomAccessCollection {
+  typealias Index = S.Index
+
+  var startIndex: S.Index {
+    _sequence.startIndex
+  }
+
+  var endIndex: S.Index {
+    _sequence.endIndex
+  }
+
+  func index(after i: S.Index) -> S.Index {
+    _sequence.index(after: i)
+  }
+
+  func index(before i: S.Index) -> S.Index {
+    _sequence.index(before: i)
+  }
+
+  func index(_ i: S.Index, offsetBy distance: Int) -> S.Index {
+    _sequence.index(i, offsetBy: distance)
+  }
+
+  func distance(from start: S.Index, to end: S.Index) -> Int {
+    _sequence.distance(from: start, to: end)
+  }
+
+  subscript(position: S.Index) -> Test.Case {
+    _mapElement(_sequence[position])
+  }
+}
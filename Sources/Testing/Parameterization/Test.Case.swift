@@ -42,15 +42,21 @@ extension Test {
       /// protocols used for encoding a stable and unique representation of the
       /// value.
       ///
+      /// The contents of this ID depend on the value of
+      /// ``Configuration/usesHumanReadableTestCaseArgumentIDs`` for the current
+      /// configuration.
+      ///
       /// ## See Also
       ///
       /// - ``CustomTestArgumentEncodable``
       @_spi(ForToolsIntegrationOnly)
       public var id: ID? {
+        let isHumanReadable = Configuration.current?.usesHumanReadableTestCaseArgumentIDs ?? true
+
         // FIXME: Capture the error and propagate to the user, not as a test
         // failure but as an advisory warning. A missing argument ID will
         // prevent re-running the test case, but is not a blocking issue.
-        try? Argument.ID(identifying: value, parameter: parameter)
+        return try? Argument.ID(identifying: value, parameter: parameter, isHumanReadable: isHumanReadable)
       }
 
       /// The value of this parameterized test argument.
@@ -74,8 +74,33 @@ public struct TypeInfo: Sendable {
 // MARK: - Name
 
 extension TypeInfo {
+  /// The number of shards in ``_fullyQualifiedNameComponentsCache``.
+  private static var _fullyQualifiedNameComponentsCacheShardCount: Int {
+    32
+  }
+
   /// An in-memory cache of fully-qualified type name components.
-  private static let _fullyQualifiedNameComponentsCache = Locked<[ObjectIdentifier: [String]]>()
+  ///
+  /// This cache is read far more often than it is written to, and is read from
+  /// many threads at once during a parallelized test run. It is split into
+  /// shards, each protected by its own lock, so that concurrent lookups of
+  /// different types rarely contend for the same lock. Use
+  /// ``_fullyQualifiedNameComponentsCache(for:)`` to get the shard for a type.
+  private static let _fullyQualifiedNameComponentsCache: [Locked<[ObjectIdentifier: [String]]>] = (0 ..< _fullyQualifiedNameComponentsCacheShardCount).map { _ in
+    Locked(label: "TypeInfo fully-qualified name cache")
+  }
+
+  /// Get the shard of ``_fullyQualifiedNameComponentsCache`` that holds the
+  /// fully-qualified name components of a given type.
+  ///
+  /// - Parameters:
+  ///   - typeID: The identifier of the type of interest.
+  ///
+  /// - Returns: The shard of the cache responsible for `typeID`.
+  private static func _fullyQualifiedNameComponentsCache(for typeID: ObjectIdentifier) -> Locked<[ObjectIdentifier: [String]]> {
+    let shardIndex = UInt(bitPattern: typeID.hashValue) % UInt(_fullyQualifiedNameComponentsCacheShardCount)
+    return _fullyQualifiedNameComponentsCache[Int(shardIndex)]
+  }
 
   /// The complete name of this type, with the names of all referenced types
   /// fully-qualified by their module names when possible.
@@ -95,7 +120,9 @@ extension TypeInfo {
   public var fullyQualifiedNameComponents: [String] {
     switch _kind {
     case let .type(type):
-      if let cachedResult = Self._fullyQualifiedNameComponentsCache.rawValue[ObjectIdentifier(type)] {
+      let typeID = ObjectIdentifier(type)
+      let cache = Self._fullyQualifiedNameComponentsCache(for: typeID)
+      if let cachedResult = cache.withLock({ $0[typeID] }) {
         return cachedResult
       }
 
@@ -116,8 +143,8 @@ extension TypeInfo {
       // those out as they're uninteresting to us.
       result = result.filter { !$0.starts(with: "(unknown context at") }
 
-      Self._fullyQualifiedNameComponentsCache.withLock { fullyQualifiedNameComponentsCache in
-        fullyQualifiedNameComponentsCache[ObjectIdentifier(type)] = result
+      cache.withLock { fullyQualifiedNameComponentsCache in
+        fullyQualifiedNameComponentsCache[typeID] = result
       }
 
       return result
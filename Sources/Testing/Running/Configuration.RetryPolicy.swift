@@ -0,0 +1,118 @@
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for Swift project authors
+//
+
+extension Configuration {
+  /// A type describing whether, and how, to retry test cases that fail.
+  ///
+  /// When a ``Runner`` is run with a retry policy, it notes each test case that
+  /// records an unknown issue. After each iteration of the test plan, it runs
+  /// those test cases again, one at a time, so that they do not contend for
+  /// resources with other tests. Each test case is retried until it passes or
+  /// until it has been retried ``maximumRetryCount`` times, and an event of
+  /// kind ``Event/Kind-swift.enum/testCaseRetried(_:)`` is posted describing
+  /// whether it is flaky or consistently failing.
+  ///
+  /// Issues recorded by a test case before it is retried are still reported.
+  /// Retries are not reported as they run: by the time a test case is retried,
+  /// the events of kind ``Event/Kind-swift.enum/testEnded`` for its test and
+  /// for that test's containing suites have already been posted. No other
+  /// events are posted for the test case's retries; instead, the single event
+  /// of kind ``Event/Kind-swift.enum/testCaseRetried(_:)`` posted for it once
+  /// it has been retried describes the issues its failed retries recorded.
+  @_spi(Experimental) @_spi(ForToolsIntegrationOnly)
+  public struct RetryPolicy: Sendable {
+    /// The maximum number of times to retry each failed test case.
+    ///
+    /// - Precondition: The value of this property must be greater than or equal
+    ///   to `1`.
+    public var maximumRetryCount: Int {
+      willSet {
+        precondition(newValue >= 1, "Failed test cases must be retried at least once.")
+      }
+    }
+
+    /// Whether or not to retry each failed test case in a new process.
+    ///
+    /// If the value of this property is `true`, each retry is run in a child
+    /// process started using ``Configuration/exitTestHandler``, so that state
+    /// left behind in the current process by the failed attempt cannot affect
+    /// the retry. Test cases whose arguments cannot be identified across
+    /// processes (see ``Test/Case/Argument/id``) are retried in the current
+    /// process instead.
+    ///
+    /// On platforms that do not support exit tests, the value of this property
+    /// is ignored.
+    public var retriesInNewProcess: Bool
+
+    /// Initialize an instance of this type.
+    ///
+    /// - Parameters:
+    ///   - maximumRetryCount: The maximum number of times to retry each failed
+    ///     test case.
+    ///   - retriesInNewProcess: Whether or not to retry each failed test case
+    ///     in a new process.
+    public init(maximumRetryCount: Int, retriesInNewProcess: Bool = false) {
+      precondition(maximumRetryCount >= 1, "Failed test cases must be retried at least once.")
+      self.maximumRetryCount = maximumRetryCount
+      self.retriesInNewProcess = retriesInNewProcess
+    }
+  }
+}
+
+// MARK: - Results
+
+extension Configuration.RetryPolicy {
+  /// A type describing the outcome of retrying a failed test case.
+  public struct Result: Sendable, Codable, Equatable {
+    /// An enumeration describing the verdicts a retried test case can receive.
+    public enum Verdict: String, Sendable, Codable {
+      /// The test case passed when it was retried.
+      case flaky
+
+      /// The test case failed every time it was retried.
+      case consistentlyFailing
+    }
+
+    /// The verdict for the test case.
+    public var verdict: Verdict
+
+    /// The number of times the test case was retried.
+    public var retryCount: Int
+
+    /// Descriptions of the unknown issues recorded while the test case was
+    /// retried, in the order in which they were recorded.
+    ///
+    /// If the test case is flaky, only the retries before the last one that
+    /// passed contribute to this array.
+    public var failureDescriptions: [String]
+
+    public init(verdict: Verdict, retryCount: Int, failureDescriptions: [String] = []) {
+      self.verdict = verdict
+      self.retryCount = retryCount
+      self.failureDescriptions = failureDescriptions
+    }
+  }
+}
+
+// MARK: - Formatting
+
+extension Configuration.RetryPolicy.Result {
+  /// A human-readable summary of this result.
+  var summary: String {
+    switch verdict {
+    case .flaky:
+      "is flaky: it passed on retry \(retryCount)"
+    case .consistentlyFailing where retryCount == 1:
+      "failed consistently: it failed again when retried"
+    case .consistentlyFailing:
+      "failed consistently: it failed all \(retryCount) retries"
+    }
+  }
+}
@@ -105,6 +105,23 @@ public struct Configuration: Sendable {
   /// By default, the value of this property allows for a single iteration.
   public var repetitionPolicy: RepetitionPolicy = .once
 
+  /// Whether or not, and how, to repeat individual test cases to find
+  /// intermittent failures.
+  ///
+  /// If the value of this property is not `nil`, each test case in the test
+  /// plan is run repeatedly, and possibly concurrently, according to the
+  /// policy. By default, the value of this property is `nil`.
+  @_spi(Experimental)
+  public var flakeHuntingPolicy: FlakeHuntingPolicy?
+
+  /// Whether or not, and how, to retry test cases that fail.
+  ///
+  /// If the value of this property is not `nil`, test cases that record
+  /// unknown issues are run again after each iteration of the test plan
+  /// according to the policy. By default, the value of this property is `nil`.
+  @_spi(Experimental)
+  public var retryPolicy: RetryPolicy?
+
   // MARK: - Isolation context for synchronous tests
 
   /// The isolation context to use for synchronous test functions.
@@ -187,9 +204,94 @@ public struct Configuration: Sendable {
   /// significant backpressure on the event handler.
   public var deliverExpectationCheckedEvents = false
 
+  /// Whether or not to count the expectations checked while each test case
+  /// runs.
+  ///
+  /// When the value of this property is `true`, the number of expectations
+  /// that passed and failed while a test case ran is attached to the
+  /// ``Event/Kind-swift.enum/testCaseEnded`` event posted for that test case
+  /// (see ``Event/expectationCounts``.) This is significantly less expensive
+  /// than setting ``deliverExpectationCheckedEvents`` to `true` when only the
+  /// number of expectations is of interest.
+  ///
+  /// Expectations checked from a task that is not a child of the task running a
+  /// test case (for example, a detached task) are not counted.
+  public var countExpectationsChecked = false
+
+  /// Whether or not to track the heap allocations made while each test case
+  /// runs.
+  ///
+  /// When the value of this property is `true`, the number and size of heap
+  /// allocations and deallocations made while a test case ran is attached to
+  /// the ``Event/Kind-swift.enum/testCaseEnded`` event posted for that test
+  /// case (see ``Event/allocationCounts``.) Allocations are also tracked for
+  /// any test case with an ``AllocationBudgetTrait``, regardless of the value
+  /// of this property.
+  ///
+  /// Allocation tracking is only available if the testing library was built
+  /// with `SWT_ENABLE_ALLOCATION_TRACKING` defined. Only allocations made by
+  /// the thread that starts running a test case are tracked, and if the test
+  /// case resumes on a different thread after suspending, no counts are
+  /// reported for it.
+  ///
+  /// When parallelization is enabled, the counts reported for a test case are
+  /// approximate: while it is suspended, other test cases may run on the same
+  /// thread, and their allocations are counted too. Test cases of tests with an
+  /// ``AllocationBudgetTrait`` always run in isolation, so their counts are not
+  /// affected.
+  @_spi(Experimental)
+  public var trackAllocations = false
+
+  /// Whether or not to measure hardware and software performance counters
+  /// while each test case runs.
+  ///
+  /// When the value of this property is `true`, an event of kind
+  /// ``Event/Kind-swift.enum/performanceCountersMeasured(_:)`` is posted after
+  /// the body of each test case runs. Only the thread that starts running a
+  /// test case is measured, and if the test case resumes on a different thread
+  /// after suspending, no event is posted for it.
+  ///
+  /// When parallelization is enabled, the values reported for a test case are
+  /// approximate: while it is suspended, other test cases may run on the same
+  /// thread, and their work is counted too. The `--performance-counters`
+  /// command-line argument disables parallelization for this reason.
+  ///
+  /// Performance counters are currently only available on Linux.
+  @_spi(Experimental)
+  public var measurePerformanceCounters = false
+
+  /// Whether or not to sample the call stacks of the process while each test
+  /// case runs.
+  ///
+  /// When the value of this property is `true`, an event of kind
+  /// ``Event/Kind-swift.enum/testCaseProfiled(_:)`` is posted after the body of
+  /// each test case runs. Samples are taken from every thread in the process,
+  /// so only one test case is profiled at a time; disable parallelization (see
+  /// ``isParallelizationEnabled``) to profile every test case.
+  ///
+  /// Profiling is currently only available on Linux.
+  @_spi(Experimental)
+  public var profileTestCases = false
+
   /// The event handler to which events should be passed when they occur.
   public var eventHandler: Event.Handler = { _, _ in }
 
+  /// Whether or not the IDs of arguments passed to parameterized tests must be
+  /// human-readable.
+  ///
+  /// When the value of this property is `true` (the default), the ID of each
+  /// test argument (see ``Test/Case/Argument/id``) contains a JSON encoding of
+  /// the argument that can be decoded again. When the value of this property
+  /// is `false`, the ID instead contains a compact 128-bit hash computed from
+  /// the argument's encoded form without producing JSON. Hashed IDs are stable
+  /// across runs and processes and are much less expensive to compute, but an
+  /// argument's hashed ID is not equal to its JSON ID.
+  ///
+  /// Set the value of this property to `false` when test case IDs are only used
+  /// to distinguish test cases from one another (for example, when no tool is
+  /// consuming the event stream.)
+  public var usesHumanReadableTestCaseArgumentIDs = true
+
 #if !SWT_NO_EXIT_TESTS
   /// A handler that is invoked when an exit test starts.
   ///
@@ -212,6 +314,16 @@ public struct Configuration: Sendable {
   /// the instance's event handler.
   public var verbosity = 0
 
+  // MARK: - Performance baselines
+
+  /// The performance baselines to compare test cases against, if any.
+  ///
+  /// If the value of this property is not `nil`, the duration of each test
+  /// case is measured and either added to its baseline or compared against it,
+  /// depending on the value of ``PerformanceBaselines/isUpdating``.
+  @_spi(Experimental)
+  public var performanceBaselines: PerformanceBaselines?
+
   // MARK: - Test selection
 
   /// The test filter to which tests should be filtered when run.
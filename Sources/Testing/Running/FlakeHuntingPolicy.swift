@@ -0,0 +1,238 @@
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for Swift project authors
+//
+
+private import _TestingInternals
+
+/// A type describing how to repeat individual test cases in order to find
+/// intermittent failures.
+///
+/// Unlike ``Configuration/RepetitionPolicy-swift.struct``, which repeats an
+/// entire test plan serially, a flake hunting policy repeats each test case in
+/// the plan on its own, running several attempts concurrently. Use
+/// ``Configuration/testFilter`` to select the tests to hunt in.
+///
+/// When an instance of this type is set as the value of
+/// ``Configuration/flakeHuntingPolicy``, the runner runs the body of each test
+/// case up to ``maximumAttemptCount`` times. It stops early if
+/// ``stopsAtFirstFailure`` is `true` and an attempt records an unknown issue,
+/// or if the confidence interval of the test case's failure rate lies entirely
+/// above or below ``failureRateThreshold``. When it stops, it posts an event of
+/// kind ``Event/Kind-swift.enum/flakeHuntEnded(_:)`` describing how often the
+/// test case failed.
+///
+/// Attempts of a test case run one at a time if parallelization is disabled
+/// for its test or if its test must run in isolation.
+@_spi(Experimental) @_spi(ForToolsIntegrationOnly)
+public struct FlakeHuntingPolicy: Sendable {
+  /// The maximum number of times to run each test case.
+  ///
+  /// - Precondition: The value of this property must be greater than or equal
+  ///   to `1`.
+  public var maximumAttemptCount: Int {
+    willSet {
+      precondition(newValue >= 1, "Test cases must be attempted at least once.")
+    }
+  }
+
+  /// Whether or not to stop running a test case as soon as one of its attempts
+  /// records an unknown issue.
+  ///
+  /// Attempts that are already running when the first failure is observed are
+  /// allowed to finish and are included in the result.
+  public var stopsAtFirstFailure: Bool
+
+  /// The failure rate against which to test each test case, if any.
+  ///
+  /// If the value of this property is not `nil`, a test case stops being
+  /// attempted once the 95% confidence interval of its failure rate lies
+  /// entirely above or entirely below this value.
+  public var failureRateThreshold: Double?
+
+  /// The maximum number of attempts of a test case to run at the same time.
+  ///
+  /// If the value of this property is `nil`, the number of available processors
+  /// is used.
+  public var maximumConcurrentAttemptCount: Int?
+
+  /// Initialize an instance of this type.
+  ///
+  /// - Parameters:
+  ///   - maximumAttemptCount: The maximum number of times to run each test
+  ///     case.
+  ///   - stopsAtFirstFailure: Whether or not to stop running a test case as
+  ///     soon as one of its attempts records an unknown issue.
+  ///   - failureRateThreshold: The failure rate against which to test each
+  ///     test case, if any.
+  ///   - maximumConcurrentAttemptCount: The maximum number of attempts of a
+  ///     test case to run at the same time, or `nil` to use the number of
+  ///     available processors.
+  public init(maximumAttemptCount: Int, stopsAtFirstFailure: Bool = true, failureRateThreshold: Double? = nil, maximumConcurrentAttemptCount: Int? = nil) {
+    precondition(maximumAttemptCount >= 1, "Test cases must be attempted at least once.")
+    self.maximumAttemptCount = maximumAttemptCount
+    self.stopsAtFirstFailure = stopsAtFirstFailure
+    self.failureRateThreshold = failureRateThreshold
+    self.maximumConcurrentAttemptCount = maximumConcurrentAttemptCount
+  }
+
+  /// Whether or not a test case with the given result should stop being
+  /// attempted.
+  ///
+  /// - Parameters:
+  ///   - result: The result of the attempts of a test case that have finished
+  ///     so far.
+  ///
+  /// - Returns: Whether or not to stop starting new attempts.
+  func shouldStop(after result: Result) -> Bool {
+    if result.attemptCount >= maximumAttemptCount {
+      return true
+    }
+    if stopsAtFirstFailure && result.failureCount > 0 {
+      return true
+    }
+    if let failureRateThreshold, result.attemptCount > 0 {
+      let confidenceInterval = result.failureRateConfidenceInterval
+      return confidenceInterval.upperBound < failureRateThreshold || confidenceInterval.lowerBound > failureRateThreshold
+    }
+    return false
+  }
+}
+
+// MARK: - Results
+
+extension FlakeHuntingPolicy {
+  /// A type describing how often a test case failed while hunting for flakes.
+  public struct Result: Sendable, Codable, Equatable {
+    /// The number of attempts that ran to completion.
+    public var attemptCount: Int
+
+    /// The number of attempts that recorded at least one unknown issue.
+    public var failureCount: Int
+
+    /// The fraction of attempts that failed.
+    public var failureRate: Double {
+      attemptCount > 0 ? Double(failureCount) / Double(attemptCount) : 0
+    }
+
+    /// The 95% confidence interval of the test case's true failure rate.
+    ///
+    /// The interval is computed as a Wilson score interval, which remains
+    /// meaningful when no attempts (or every attempt) failed.
+    public var failureRateConfidenceInterval: ClosedRange<Double> {
+      guard attemptCount > 0 else {
+        return 0 ... 1
+      }
+
+      // The critical value of the standard normal distribution for a two-sided
+      // 95% confidence level.
+      let z = 1.959964
+      let n = Double(attemptCount)
+      let p = failureRate
+      let denominator = 1 + z * z / n
+      let center = (p + z * z / (2 * n)) / denominator
+      let halfWidth = z * (p * (1 - p) / n + z * z / (4 * n * n)).squareRoot() / denominator
+      let lowerBound = failureCount == 0 ? 0 : max(0, center - halfWidth)
+      let upperBound = failureCount == attemptCount ? 1 : min(1, center + halfWidth)
+      return lowerBound ... upperBound
+    }
+
+    public init(attemptCount: Int = 0, failureCount: Int = 0) {
+      self.attemptCount = attemptCount
+      self.failureCount = failureCount
+    }
+  }
+}
+
+// MARK: - Hunting
+
+extension Runner {
+  /// Run a test case repeatedly according to this runner's flake hunting
+  /// policy.
+  ///
+  /// - Parameters:
+  ///   - testCase: The test case to run.
+  ///   - step: The runner plan step associated with this test case.
+  ///   - body: A function that runs one attempt of `testCase`.
+  ///
+  /// If ``Configuration/flakeHuntingPolicy`` is `nil`, this function calls
+  /// `body` once. Otherwise, it calls `body` repeatedly, concurrently if
+  /// allowed, until the policy is satisfied, then posts an event of kind
+  /// ``Event/Kind-swift.enum/flakeHuntEnded(_:)`` for `testCase`.
+  func huntingFlakes(in testCase: Test.Case, within step: Plan.Step, _ body: @escaping @Sendable () async -> Void) async {
+    guard let flakeHuntingPolicy = configuration.flakeHuntingPolicy else {
+      return await body()
+    }
+
+    let maximumConcurrentAttemptCount = if step.action.isParallelizationEnabled == false || step.test.isIsolated {
+      1
+    } else {
+      max(1, flakeHuntingPolicy.maximumConcurrentAttemptCount ?? activeProcessorCount)
+    }
+
+    var result = FlakeHuntingPolicy.Result()
+    await withTaskGroup(of: Bool.self) { taskGroup in
+      var startedAttemptCount = 0
+      var runningAttemptCount = 0
+      while true {
+        // Start another attempt if the policy has not yet been satisfied and
+        // there is room for it. Otherwise, wait for a running attempt to finish
+        // and account for it.
+        let canStartAttempt = !Task.isCancelled
+          && startedAttemptCount < flakeHuntingPolicy.maximumAttemptCount
+          && !flakeHuntingPolicy.shouldStop(after: result)
+        if canStartAttempt && runningAttemptCount < maximumConcurrentAttemptCount {
+          taskGroup.addTask {
+            await Issue.recordingUnknownIssues(during: body)
+          }
+          startedAttemptCount += 1
+          runningAttemptCount += 1
+        } else if let failed = await taskGroup.next() {
+          runningAttemptCount -= 1
+          result.attemptCount += 1
+          if failed {
+            result.failureCount += 1
+          }
+        } else {
+          break
+        }
+      }
+    }
+
+    Event.post(.flakeHuntEnded(result), for: (step.test, testCase), configuration: configuration)
+  }
+}
+
+// MARK: - Formatting
+
+extension FlakeHuntingPolicy.Result {
+  /// Get a human-readable description of a fraction as a percentage.
+  ///
+  /// - Parameters:
+  ///   - fraction: The fraction to describe.
+  ///
+  /// - Returns: A description of `fraction` as a percentage with two decimal
+  ///   places, such as `"12.50%"`.
+  private static func _descriptionOfPercentage(_ fraction: Double) -> String {
+    withUnsafeTemporaryAllocation(of: CChar.self, capacity: 64) { buffer in
+      withVaList([fraction * 100]) { args in
+        _ = vsnprintf(buffer.baseAddress!, buffer.count, "%.2f%%", args)
+      }
+      return String(cString: buffer.baseAddress!)
+    }
+  }
+
+  /// A human-readable summary of this result.
+  var summary: String {
+    let confidenceInterval = failureRateConfidenceInterval
+    let failureRate = Self._descriptionOfPercentage(failureRate)
+    let lowerBound = Self._descriptionOfPercentage(confidenceInterval.lowerBound)
+    let upperBound = Self._descriptionOfPercentage(confidenceInterval.upperBound)
+    return "failed \(failureCount) of \(attemptCount.counting("attempt")) (\(failureRate), 95% confidence interval \(lowerBound)–\(upperBound))"
+  }
+}
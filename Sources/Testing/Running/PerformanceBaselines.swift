@@ -0,0 +1,349 @@
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for Swift project authors
+//
+
+private import _TestingInternals
+
+/// A type that stores the durations of previous runs of test cases and detects
+/// performance regressions against them.
+///
+/// Durations are stored per test case (for a non-parameterized test, its single
+/// test case) and per host. A host is identified by its
+/// ``hostFingerprint``, so measurements taken on one kind of machine are never
+/// compared against measurements taken on another.
+///
+/// When an instance of this type is set as the value of
+/// ``Configuration/performanceBaselines``, the runner measures the duration of
+/// each test case it runs. If ``isUpdating`` is `true`, the measurement is
+/// added to the test case's baseline. Otherwise, it is compared against the
+/// baseline according to ``regressionPolicy-swift.property`` and an issue of
+/// kind ``Issue/Kind-swift.enum/performanceRegressed(_:)`` is recorded if it
+/// is significantly slower.
+@_spi(Experimental) @_spi(ForToolsIntegrationOnly)
+public final class PerformanceBaselines: Sendable {
+  /// A type describing how to decide whether a measurement is a regression.
+  public struct RegressionPolicy: Sendable {
+    /// An enumeration describing the statistical tests that can be used to
+    /// compare a measurement against a baseline.
+    public enum StatisticalTest: Sendable {
+      /// Compare the measurement against the mean of the baseline, in units
+      /// of its sample standard deviation.
+      case zScore
+
+      /// Compare the measurement against the median of the baseline, in units
+      /// of its (scaled) median absolute deviation.
+      ///
+      /// This test is less sensitive than ``zScore`` to outliers in the
+      /// baseline.
+      case medianAbsoluteDeviation
+    }
+
+    /// The statistical test to use.
+    public var statisticalTest: StatisticalTest = .medianAbsoluteDeviation
+
+    /// The score, as computed by ``statisticalTest-swift.property``, above
+    /// which a measurement is considered a regression.
+    public var threshold: Double = 3
+
+    /// The minimum relative increase over the baseline's median for a
+    /// measurement to be considered a regression.
+    ///
+    /// This value guards against reporting statistically significant but
+    /// practically irrelevant slowdowns in test cases whose baselines are very
+    /// consistent.
+    public var minimumRelativeIncrease: Double = 0.1
+
+    /// The minimum absolute increase, in nanoseconds, over the baseline's
+    /// median for a measurement to be considered a regression.
+    ///
+    /// This value guards against reporting noise in very fast test cases.
+    public var minimumNanosecondIncrease: Int64 = 1_000_000
+
+    /// The minimum number of samples a baseline must contain before
+    /// measurements are compared against it.
+    public var minimumSampleCount = 3
+
+    public init() {}
+  }
+
+  /// A type describing a detected performance regression.
+  public struct Regression: Sendable, Codable {
+    /// The measured duration, in nanoseconds.
+    public var nanoseconds: Int64
+
+    /// The median duration of the baseline, in nanoseconds.
+    public var baselineMedianNanoseconds: Int64
+
+    /// The number of samples in the baseline.
+    public var baselineSampleCount: Int
+
+    /// The score of the measurement computed by the statistical test.
+    public var score: Double
+  }
+
+  /// The policy used to detect regressions.
+  public let regressionPolicy: RegressionPolicy
+
+  /// Whether or not new measurements are added to the baselines instead of
+  /// being compared against them.
+  public let isUpdating: Bool
+
+  /// The fingerprint of the host whose baselines are used.
+  public let hostFingerprint: String
+
+  /// The maximum number of samples kept in any one baseline.
+  ///
+  /// When a baseline is updated and would exceed this many samples, its oldest
+  /// samples are discarded.
+  private static var _maximumSampleCount: Int {
+    20
+  }
+
+  /// A type describing the serialized form of an instance of this type.
+  private struct _Storage: Sendable, Codable {
+    /// The baselines for each host, keyed by host fingerprint and then by test
+    /// case key. Each baseline is an array of durations in nanoseconds, oldest
+    /// first.
+    var hosts = [String: [String: [Int64]]]()
+  }
+
+  /// The baselines of all hosts.
+  private let _storage: Locked<_Storage>
+
+  /// Initialize an instance of this type.
+  ///
+  /// - Parameters:
+  ///   - regressionPolicy: The policy used to detect regressions.
+  ///   - isUpdating: Whether or not new measurements are added to the
+  ///     baselines instead of being compared against them.
+  ///   - hostFingerprint: The fingerprint of the host whose baselines should
+  ///     be used. By default, the fingerprint of the current host is used.
+  public init(regressionPolicy: RegressionPolicy = .init(), isUpdating: Bool = false, hostFingerprint: String? = nil) {
+    self.regressionPolicy = regressionPolicy
+    self.isUpdating = isUpdating
+    self.hostFingerprint = hostFingerprint ?? Self.currentHostFingerprint
+    _storage = Locked(rawValue: _Storage(), label: "Performance baselines")
+  }
+
+  /// The fingerprint of the current host.
+  ///
+  /// The fingerprint is derived from the target triple, the operating system
+  /// version, and the number of available processors. It can be overridden by
+  /// setting the `SWT_PERFORMANCE_HOST_FINGERPRINT` environment variable, for
+  /// instance to share baselines among a pool of identical machines.
+  public static let currentHostFingerprint: String = {
+    if let fingerprint = Environment.variable(named: "SWT_PERFORMANCE_HOST_FINGERPRINT"), !fingerprint.isEmpty {
+      return fingerprint
+    }
+
+    return "\(targetTriple ?? "unknown"); \(operatingSystemVersion); \(activeProcessorCount.counting("processor"))"
+  }()
+
+  // MARK: - Measuring
+
+  /// Get the key under which a test case's baseline is stored.
+  ///
+  /// - Parameters:
+  ///   - test: The test.
+  ///   - testCase: The test case.
+  ///
+  /// - Returns: A string uniquely identifying `testCase`, or `nil` if any of
+  ///   its arguments cannot be identified.
+  ///
+  /// The key of a parameterized test case includes stable hashes of its
+  /// arguments, so it does not depend on the value of
+  /// ``Configuration/usesHumanReadableTestCaseArgumentIDs``.
+  static func key(for test: Test, testCase: Test.Case) -> String? {
+    let testID = String(describing: test.id)
+    guard testCase.isParameterized else {
+      return testID
+    }
+
+    var argumentHashes = [String]()
+    for argument in testCase.arguments {
+      guard let argumentID = try? Test.Case.Argument.ID(identifying: argument.value, parameter: argument.parameter, isHumanReadable: false) else {
+        return nil
+      }
+      argumentHashes.append(argumentID.bytes.lazy.map { byte in
+        let hex = String(byte, radix: 16)
+        return byte < 0x10 ? "0\(hex)" : hex
+      }.joined())
+    }
+    return "\(testID)[\(argumentHashes.joined(separator: ","))]"
+  }
+
+  /// Record a measurement of a test case.
+  ///
+  /// - Parameters:
+  ///   - nanoseconds: The measured duration of the test case.
+  ///   - key: The key of the test case, as returned by
+  ///     ``key(for:testCase:)``.
+  ///
+  /// - Returns: A description of the regression, if the measurement is a
+  ///   regression. If ``isUpdating`` is `true`, the result is always `nil`.
+  func record(_ nanoseconds: Int64, forKey key: String) -> Regression? {
+    _storage.withLock { storage in
+      if isUpdating {
+        var samples = storage.hosts[hostFingerprint, default: [:]][key, default: []]
+        samples.append(nanoseconds)
+        if samples.count > Self._maximumSampleCount {
+          samples.removeFirst(samples.count - Self._maximumSampleCount)
+        }
+        storage.hosts[hostFingerprint, default: [:]][key] = samples
+        return nil
+      }
+
+      guard let samples = storage.hosts[hostFingerprint]?[key] else {
+        return nil
+      }
+      return Self.regression(of: nanoseconds, against: samples, policy: regressionPolicy)
+    }
+  }
+
+  /// Compare a measurement against a baseline.
+  ///
+  /// - Parameters:
+  ///   - nanoseconds: The measured duration.
+  ///   - samples: The durations in the baseline.
+  ///   - policy: The policy used to detect regressions.
+  ///
+  /// - Returns: A description of the regression, if `nanoseconds` is a
+  ///   regression according to `policy`, or `nil` otherwise.
+  static func regression(of nanoseconds: Int64, against samples: [Int64], policy: RegressionPolicy) -> Regression? {
+    guard samples.count >= max(1, policy.minimumSampleCount) else {
+      return nil
+    }
+
+    func median(of values: [Double]) -> Double {
+      let values = values.sorted()
+      let middle = values.count / 2
+      return if values.count % 2 == 1 {
+        values[middle]
+      } else {
+        (values[middle - 1] + values[middle]) / 2
+      }
+    }
+
+    let values = samples.map(Double.init)
+    let medianValue = median(of: values)
+    let increase = Double(nanoseconds) - medianValue
+    guard increase >= Double(policy.minimumNanosecondIncrease),
+          increase >= medianValue * policy.minimumRelativeIncrease else {
+      return nil
+    }
+
+    let score: Double
+    switch policy.statisticalTest {
+    case .zScore:
+      let mean = values.reduce(0, +) / Double(values.count)
+      let variance = values.count > 1
+        ? values.reduce(0) { $0 + ($1 - mean) * ($1 - mean) } / Double(values.count - 1)
+        : 0
+      let standardDeviation = variance.squareRoot()
+      score = standardDeviation > 0 ? (Double(nanoseconds) - mean) / standardDeviation : .infinity
+    case .medianAbsoluteDeviation:
+      // Scale the MAD so that it estimates the standard deviation of normally
+      // distributed data, making thresholds comparable with z-scores.
+      let medianAbsoluteDeviation = 1.4826 * median(of: values.map { abs($0 - medianValue) })
+      score = medianAbsoluteDeviation > 0 ? increase / medianAbsoluteDeviation : .infinity
+    }
+    guard score > policy.threshold else {
+      return nil
+    }
+
+    return Regression(
+      nanoseconds: nanoseconds,
+      baselineMedianNanoseconds: Int64(medianValue),
+      baselineSampleCount: samples.count,
+      score: score
+    )
+  }
+
+  // MARK: - Reading and writing
+
+#if !SWT_NO_FILE_IO
+  /// Read baselines from a file.
+  ///
+  /// - Parameters:
+  ///   - path: The path to the file to read. If no file exists at this path,
+  ///     the resulting instance has no baselines.
+  ///   - regressionPolicy: The policy used to detect regressions.
+  ///   - isUpdating: Whether or not new measurements are added to the
+  ///     baselines instead of being compared against them.
+  ///
+  /// - Throws: Any error preventing the file from being read or decoded.
+  public convenience init(contentsOfFileAtPath path: String, regressionPolicy: RegressionPolicy = .init(), isUpdating: Bool = false) throws {
+    self.init(regressionPolicy: regressionPolicy, isUpdating: isUpdating)
+    guard let file = try? FileHandle(forReadingAtPath: path) else {
+      return
+    }
+    let bytes = try file.readToEnd()
+    if bytes.isEmpty {
+      return
+    }
+    let storage = try bytes.withUnsafeBytes { bytes in
+      try JSON.decode(_Storage.self, from: bytes)
+    }
+    _storage.withLock { $0 = storage }
+  }
+
+  /// Write these baselines to a file.
+  ///
+  /// - Parameters:
+  ///   - path: The path to the file to write. If a file exists at this path,
+  ///     it is replaced.
+  ///
+  /// - Throws: Any error preventing the file from being encoded or written.
+  ///
+  /// Baselines for hosts other than ``hostFingerprint`` that were read from a
+  /// file are preserved.
+  public func write(toFileAtPath path: String) throws {
+    let storage = _storage.rawValue
+    let file = try FileHandle(forWritingAtPath: path)
+    try JSON.withEncoding(of: storage) { json in
+      try file.write(json)
+    }
+  }
+#endif
+}
+
+// MARK: - Runner support
+
+extension Runner {
+  /// Measure a test case and compare the measurement against its baseline.
+  ///
+  /// - Parameters:
+  ///   - testCase: The test case to measure.
+  ///   - step: The runner plan step associated with this test case.
+  ///   - body: A function that runs `testCase`.
+  ///
+  /// If ``Configuration/performanceBaselines`` is `nil`, this function calls
+  /// `body` without measuring it. This function must be called with
+  /// ``Test/Case/current`` set to `testCase` so that any regression is
+  /// attributed to it.
+  func measuringPerformance(of testCase: Test.Case, within step: Plan.Step, _ body: () async -> Void) async {
+    guard let performanceBaselines = configuration.performanceBaselines,
+          let key = PerformanceBaselines.key(for: step.test, testCase: testCase) else {
+      return await body()
+    }
+
+    let startInstant = Test.Clock.Instant.now
+    await body()
+    let nanoseconds = startInstant.nanoseconds(until: .now)
+
+    if let regression = performanceBaselines.record(nanoseconds, forKey: key) {
+      let issue = Issue(
+        kind: .performanceRegressed(regression),
+        comments: [],
+        sourceContext: .init(backtrace: nil, sourceLocation: step.test.sourceLocation)
+      )
+      issue.record(configuration: configuration)
+    }
+  }
+}
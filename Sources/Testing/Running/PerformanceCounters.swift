@@ -0,0 +1,132 @@
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for Swift project authors
+//
+
+private import _TestingInternals
+
+/// A type describing the values of hardware and software performance counters
+/// measured while a test case ran.
+///
+/// Each value is `nil` if the corresponding counter was not available. Hardware
+/// counters (instructions, cycles, cache misses, and branch misses) are often
+/// unavailable in virtual machines and containers, in which case only software
+/// counters are measured.
+///
+/// Performance counters are only measured when
+/// ``Configuration/measurePerformanceCounters`` is `true`, and are currently
+/// only supported on Linux.
+@_spi(Experimental)
+public struct PerformanceCounters: Sendable, Codable, Equatable {
+  /// The number of instructions retired.
+  ///
+  /// This value is much less sensitive to contention from other processes than
+  /// the test case's duration, making it a good metric for detecting
+  /// performance regressions on shared hosts.
+  public var instructions: Int?
+
+  /// The number of CPU cycles elapsed.
+  public var cycles: Int?
+
+  /// The number of last-level cache misses.
+  public var cacheMisses: Int?
+
+  /// The number of mispredicted branches.
+  public var branchMisses: Int?
+
+  /// The amount of CPU time consumed, in nanoseconds.
+  public var taskClockNanoseconds: Int?
+
+  /// The number of page faults.
+  public var pageFaults: Int?
+}
+
+// MARK: - Measuring
+
+extension PerformanceCounters {
+  /// Initialize an instance of this type from the values reported by
+  /// `_TestingInternals`.
+  ///
+  /// - Parameters:
+  ///   - values: The values to convert.
+  fileprivate init(_ values: SWTPerformanceCounterValues) {
+    func value(_ value: Int64) -> Int? {
+      value >= 0 ? Int(clamping: value) : nil
+    }
+    self.init(
+      instructions: value(values.instructions),
+      cycles: value(values.cycles),
+      cacheMisses: value(values.cacheMisses),
+      branchMisses: value(values.branchMisses),
+      taskClockNanoseconds: value(values.taskClockNanoseconds),
+      pageFaults: value(values.pageFaults)
+    )
+  }
+}
+
+extension Runner {
+  /// Call a function while measuring its performance counters, then post them
+  /// as an event.
+  ///
+  /// - Parameters:
+  ///   - body: A function to call.
+  ///
+  /// - Returns: Whatever is returned by `body`.
+  ///
+  /// - Throws: Whatever is thrown by `body`.
+  ///
+  /// If ``Configuration/measurePerformanceCounters`` is `false`, this function
+  /// calls `body` without measuring it. Otherwise, an event of kind
+  /// ``Event/Kind-swift.enum/performanceCountersMeasured(_:)`` is posted for
+  /// the current test case after `body` returns or throws.
+  func measuringPerformanceCounters<R>(_ body: () async throws -> R) async rethrows -> R {
+    guard configuration.measurePerformanceCounters,
+          let counters = swt_performanceCountersStart() else {
+      return try await body()
+    }
+    defer {
+      var values = SWTPerformanceCounterValues()
+      if swt_performanceCountersStop(counters, &values) {
+        Event.post(.performanceCountersMeasured(PerformanceCounters(values)), configuration: configuration)
+      }
+    }
+    return try await body()
+  }
+}
+
+// MARK: - Formatting
+
+extension PerformanceCounters {
+  /// A human-readable summary of these performance counters.
+  var summary: String {
+    func misses(_ count: Int, _ noun: String) -> String {
+      count == 1 ? "1 \(noun) miss" : "\(count) \(noun) misses"
+    }
+
+    var components = [String]()
+    if let instructions {
+      components.append(instructions.counting("instruction"))
+    }
+    if let cycles {
+      components.append(cycles.counting("cycle"))
+    }
+    if let cacheMisses {
+      components.append(misses(cacheMisses, "cache"))
+    }
+    if let branchMisses {
+      components.append(misses(branchMisses, "branch"))
+    }
+    if let taskClockNanoseconds {
+      components.append("\(BenchmarkTrait.Statistics.descriptionOfNanoseconds(Double(taskClockNanoseconds))) of CPU time")
+    }
+    if let pageFaults {
+      components.append(pageFaults.counting("page fault"))
+    }
+    return components.joined(separator: ", ")
+  }
+}
@@ -0,0 +1,138 @@
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for Swift project authors
+//
+
+extension Runner {
+  /// A type that allows some test cases to run in isolation from all other
+  /// test cases in a test run.
+  ///
+  /// Test cases enter the gate with either shared or exclusive access. Any
+  /// number of test cases can hold shared access at once, while a test case
+  /// holding exclusive access runs alone. Waiting test cases are admitted in
+  /// the order they arrived, so a test case waiting for exclusive access is
+  /// not starved by test cases that arrive after it.
+  ///
+  /// An instance of this type is only created for a test run if the run
+  /// contains at least one test that requires isolation (see
+  /// ``Test/isIsolated``), so other runs do not pay for it.
+  final class IsolationGate: Sendable {
+    /// A type describing a test case waiting to enter the gate.
+    private struct _Waiter {
+      /// Whether or not the test case is waiting for exclusive access.
+      var isExclusive: Bool
+
+      /// The continuation to resume when the test case is admitted.
+      var continuation: CheckedContinuation<Void, Never>
+    }
+
+    /// A type describing the mutable state of the gate.
+    private struct _State {
+      /// The number of test cases currently holding shared access.
+      var sharedCount = 0
+
+      /// Whether or not a test case currently holds exclusive access.
+      var isHeldExclusively = false
+
+      /// The test cases waiting to enter the gate, in the order they arrived.
+      var waiters = [_Waiter]()
+
+      /// Whether or not a test case can be admitted right now.
+      ///
+      /// - Parameters:
+      ///   - isExclusive: Whether or not the test case needs exclusive access.
+      ///
+      /// - Returns: Whether or not the test case can be admitted.
+      func canAdmit(exclusive isExclusive: Bool) -> Bool {
+        if isHeldExclusively {
+          return false
+        }
+        return !isExclusive || sharedCount == 0
+      }
+
+      /// Record that a test case has been admitted.
+      ///
+      /// - Parameters:
+      ///   - isExclusive: Whether or not the test case was granted exclusive
+      ///     access.
+      mutating func admit(exclusive isExclusive: Bool) {
+        if isExclusive {
+          isHeldExclusively = true
+        } else {
+          sharedCount += 1
+        }
+      }
+    }
+
+    /// The mutable state of the gate.
+    private let _state = Locked(rawValue: _State(), label: "Test case isolation gate")
+
+    /// Call a function while holding shared or exclusive access to this gate.
+    ///
+    /// - Parameters:
+    ///   - isExclusive: Whether or not to hold exclusive access while calling
+    ///     `body`.
+    ///   - body: The function to call.
+    ///
+    /// - Returns: Whatever is returned by `body`.
+    ///
+    /// - Throws: Whatever is thrown by `body`.
+    func withAccess<R>(exclusive isExclusive: Bool, _ body: () async throws -> R) async rethrows -> R {
+      await _enter(exclusive: isExclusive)
+      defer {
+        _leave(exclusive: isExclusive)
+      }
+      return try await body()
+    }
+
+    /// Wait until the caller is admitted to this gate.
+    ///
+    /// - Parameters:
+    ///   - isExclusive: Whether or not the caller needs exclusive access.
+    private func _enter(exclusive isExclusive: Bool) async {
+      await withCheckedContinuation { continuation in
+        let isAdmitted = _state.withLock { state in
+          if state.waiters.isEmpty && state.canAdmit(exclusive: isExclusive) {
+            state.admit(exclusive: isExclusive)
+            return true
+          }
+          state.waiters.append(_Waiter(isExclusive: isExclusive, continuation: continuation))
+          return false
+        }
+        if isAdmitted {
+          continuation.resume()
+        }
+      }
+    }
+
+    /// Leave this gate and admit as many waiting test cases as possible.
+    ///
+    /// - Parameters:
+    ///   - isExclusive: Whether or not the caller held exclusive access.
+    private func _leave(exclusive isExclusive: Bool) {
+      let admittedContinuations = _state.withLock { state in
+        if isExclusive {
+          state.isHeldExclusively = false
+        } else {
+          state.sharedCount -= 1
+        }
+
+        var result = [CheckedContinuation<Void, Never>]()
+        while let waiter = state.waiters.first, state.canAdmit(exclusive: waiter.isExclusive) {
+          state.admit(exclusive: waiter.isExclusive)
+          state.waiters.removeFirst()
+          result.append(waiter.continuation)
+        }
+        return result
+      }
+      for continuation in admittedContinuations {
+        continuation.resume()
+      }
+    }
+  }
+}
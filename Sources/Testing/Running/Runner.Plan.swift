@@ -159,9 +159,11 @@ extension Runner.Plan {
   /// - Parameters:
   ///   - tests: The tests for which a graph should be constructed.
   ///   - configuration: The configuration to use for planning.
+  ///   - startupProfile: A profile to which the durations of planning phases
+  ///     should be added, if any.
   ///
   /// - Returns: A graph of the steps corresponding to `tests`.
-  private static func _constructStepGraph(from tests: some Sequence<Test>, configuration: Configuration) async -> Graph<String, Step?> {
+  private static func _constructStepGraph(from tests: some Sequence<Test>, configuration: Configuration, startupProfile: Locked<StartupProfile>?) async -> Graph<String, Step?> {
     // Ensure that we are capturing backtraces for errors before we start
     // expecting to see them.
     Backtrace.startCachingForThrownErrors()
@@ -191,7 +193,11 @@ extension Runner.Plan {
     // their corresponding tests are effectively filtered out by the call to
     // zip() near the end of the function.
     do {
+      let filterStartInstant = Test.Clock.Instant.now
       testGraph = try configuration.testFilter.apply(to: testGraph)
+      startupProfile?.withLock { startupProfile in
+        startupProfile.add(Int(filterStartInstant.nanoseconds(until: .now)), to: .filtering)
+      }
     } catch {
       // FIXME: Handle this more gracefully, either by propagating the error
       // (which will ultimately require `Runner.init(...)` to be throwing:
@@ -203,11 +209,13 @@ extension Runner.Plan {
       // and that is already guarded earlier in the SwiftPM entry point.
     }
 
-    // For each test value, determine the appropriate action for it.
-    //
-    // FIXME: Parallelize this work. Calling `prepare(...)` on all traits and
-    // evaluating all test arguments should be safely parallelizable.
-    testGraph = await testGraph.mapValues { keyPath, test in
+    // For each test value, determine the appropriate action for it. Calling
+    // `prepare(...)` on all traits and evaluating all test arguments is safely
+    // parallelizable, so sibling tests are prepared concurrently, as many at a
+    // time as there are processors. If parallelization is disabled, tests are
+    // prepared one at a time instead.
+    let maxConcurrentChildren = configuration.isParallelizationEnabled ? activeProcessorCount : 1
+    let preparedGraph = await testGraph.concurrentMapValues(maxConcurrentChildren: maxConcurrentChildren) { _, test -> (Test, Action)? in
       // Skip any nil test, which implies this node is just a placeholder and
       // not actual test content.
       guard var test else {
@@ -222,6 +230,7 @@ extension Runner.Plan {
       // But if any throw another kind of error, keep track of the first error
       // but continue walking, because if any subsequent traits throw a
       // `SkipInfo`, the error should not be recorded.
+      let traitPreparationStartInstant = Test.Clock.Instant.now
       for trait in test.traits {
         do {
           if let trait = trait as? any SPIAwareTrait {
@@ -238,6 +247,10 @@ extension Runner.Plan {
         }
       }
 
+      startupProfile?.withLock { startupProfile in
+        startupProfile.add(Int(traitPreparationStartInstant.nanoseconds(until: .now)), to: .traitPreparation)
+      }
+
       // If no trait specified that the test should be skipped, but one did
       // throw an error, then the action is to record an issue for that error.
       if case .run = action, let error = firstCaughtError {
@@ -252,11 +265,15 @@ extension Runner.Plan {
       // run, to avoid unnecessary work. But now is the appropriate time to
       // evaluate them.
       if case .run = action {
+        let testCaseEvaluationStartInstant = Test.Clock.Instant.now
         do {
           try await test.evaluateTestCases()
         } catch {
           action = .recordIssue(Issue(for: error))
         }
+        startupProfile?.withLock { startupProfile in
+          startupProfile.add(Int(testCaseEvaluationStartInstant.nanoseconds(until: .now)), to: .testCaseEvaluation)
+        }
       }
 
       // If the test is parameterized but has no cases, mark it as skipped.
@@ -264,9 +281,15 @@ extension Runner.Plan {
         action = .skip(SkipInfo(comment: "No test cases found.", sourceContext: .init(backtrace: nil, sourceLocation: test.sourceLocation)))
       }
 
-      actionGraph.updateValue(action, at: keyPath)
-
-      return test
+      return (test, action)
+    }
+    testGraph = preparedGraph.mapValues { _, pair in
+      pair?.0
+    }
+    preparedGraph.forEach { keyPath, pair in
+      if let (_, action) = pair {
+        actionGraph.updateValue(action, at: keyPath)
+      }
     }
 
     // Now that we have allowed all the traits to update their corresponding
@@ -290,7 +313,23 @@ extension Runner.Plan {
   ///
   /// This function produces a new runner plan for the provided tests.
   public init(tests: some Sequence<Test>, configuration: Configuration) async {
-    let stepGraph = await Self._constructStepGraph(from: tests, configuration: configuration)
+    await self.init(tests: tests, configuration: configuration, startupProfile: nil)
+  }
+
+  /// Initialize an instance of this type with the specified tests and
+  /// configuration while profiling its construction.
+  ///
+  /// - Parameters:
+  ///   - tests: The tests for which a runner plan should be constructed.
+  ///   - configuration: The configuration to use for planning.
+  ///   - startupProfile: A profile to which the duration of each phase of
+  ///     planning should be added, if any.
+  init(tests: some Sequence<Test>, configuration: Configuration, startupProfile: Locked<StartupProfile>?) async {
+    let startInstant = Test.Clock.Instant.now
+    let stepGraph = await Self._constructStepGraph(from: tests, configuration: configuration, startupProfile: startupProfile)
+    startupProfile?.withLock { startupProfile in
+      startupProfile.add(Int(startInstant.nanoseconds(until: .now)), to: .planConstruction)
+    }
     self.init(stepGraph: stepGraph)
   }
 
@@ -8,6 +8,8 @@
 // See https://swift.org/CONTRIBUTORS.txt for Swift project authors
 //
 
+private import _TestingInternals
+
 extension Runner {
   /// A type which collects the task-scoped runtime state for a running
   /// ``Runner`` instance, the tests it runs, and other objects it interacts
@@ -25,6 +27,18 @@ extension Runner {
     /// The test case that is running on the current task, if any.
     var testCase: Test.Case?
 
+    /// The counts of expectations checked by the test case that is running on
+    /// the current task, if they are being counted.
+    var expectationCounts: Locked<Event.ExpectationCounts>?
+
+    /// The heap allocations made by the test case that is running on the
+    /// current task, if they are being tracked.
+    var allocationCounts: Locked<Event.AllocationCounts?>?
+
+    /// Whether or not an unknown issue has been recorded by the current task,
+    /// if this is being tracked.
+    var unknownIssueRecorded: Locked<Bool>?
+
     /// The runtime state related to the runner running on the current task,
     /// if any.
     @TaskLocal
@@ -80,6 +94,11 @@ extension Configuration {
 
     var runtimeState = Runner.RuntimeState.current ?? .init()
     runtimeState.configuration = configuration
+    // Expectations checked under this configuration do not count toward any
+    // test case run by an enclosing configuration.
+    runtimeState.expectationCounts = nil
+    runtimeState.allocationCounts = nil
+    runtimeState.unknownIssueRecorded = nil
     return try await Runner.RuntimeState.$current.withValue(runtimeState, operation: body)
   }
 
@@ -95,7 +114,7 @@ extension Configuration {
   }
 
   /// Mutable storage for ``Configuration/all``.
-  private static let _all = Locked(rawValue: _All())
+  private static let _all = Locked(rawValue: _All(), label: "Configuration registry")
 
   /// A collection containing all instances of this type that are currently set
   /// as the current configuration for a task.
@@ -114,6 +133,9 @@ extension Configuration {
     if deliverExpectationCheckedEvents {
       Self._deliverExpectationCheckedEventsCount.increment()
     }
+    if countExpectationsChecked {
+      Self._countExpectationsCheckedCount.increment()
+    }
     return Self._all.withLock { all in
       let id = all.nextID
       all.nextID += 1
@@ -134,6 +156,9 @@ extension Configuration {
     if let configuration, configuration.deliverExpectationCheckedEvents {
       Self._deliverExpectationCheckedEventsCount.decrement()
     }
+    if let configuration, configuration.countExpectationsChecked {
+      Self._countExpectationsCheckedCount.decrement()
+    }
   }
 
   /// An atomic counter that tracks the number of "current" configurations that
@@ -141,7 +166,7 @@ extension Configuration {
   ///
   /// On older Apple platforms, this property is not available and ``all`` is
   /// directly consulted instead (which is less efficient.)
-  private static let _deliverExpectationCheckedEventsCount = Locked(rawValue: 0)
+  private static let _deliverExpectationCheckedEventsCount = AtomicCounter(rawValue: 0)
 
   /// Whether or not events of the kind
   /// ``Event/Kind-swift.enum/expectationChecked(_:)`` should be delivered to
@@ -154,6 +179,20 @@ extension Configuration {
   static var deliverExpectationCheckedEvents: Bool {
     _deliverExpectationCheckedEventsCount.rawValue > 0
   }
+
+  /// An atomic counter that tracks the number of "current" configurations that
+  /// have set ``countExpectationsChecked`` to `true`.
+  private static let _countExpectationsCheckedCount = AtomicCounter(rawValue: 0)
+
+  /// Whether or not _any_ configuration set as current for a task in the
+  /// current process is counting the expectations checked by its test cases.
+  ///
+  /// To determine if an individual instance of ``Configuration`` is counting
+  /// expectations, consult the per-instance
+  /// ``Configuration/countExpectationsChecked`` property.
+  static var countExpectationsChecked: Bool {
+    _countExpectationsCheckedCount.rawValue > 0
+  }
 }
 
 // MARK: - Current test and test case
@@ -223,6 +262,176 @@ extension Test.Case {
   }
 }
 
+// MARK: - Expectation counting
+
+extension Event.ExpectationCounts {
+  /// Call a function while counting the expectations checked by the current
+  /// task and its child tasks.
+  ///
+  /// - Parameters:
+  ///   - body: A function to call.
+  ///
+  /// - Returns: The number of expectations checked while `body` ran.
+  static func counting(during body: () async -> Void) async -> Self {
+    let expectationCounts = Locked(rawValue: Self())
+    var runtimeState = Runner.RuntimeState.current ?? .init()
+    runtimeState.expectationCounts = expectationCounts
+    await Runner.RuntimeState.$current.withValue(runtimeState, operation: body)
+    return expectationCounts.rawValue
+  }
+
+  /// Count an expectation checked by the current task.
+  ///
+  /// - Parameters:
+  ///   - isPassing: Whether or not the expectation passed.
+  ///
+  /// If the current task is not counting expectations, this function has no
+  /// effect.
+  static func count(isPassing: Bool) {
+    Runner.RuntimeState.current?.expectationCounts?.withLock { expectationCounts in
+      if isPassing {
+        expectationCounts.passed += 1
+      } else {
+        expectationCounts.failed += 1
+      }
+    }
+  }
+}
+
+// MARK: - Unknown issue tracking
+
+extension Issue {
+  /// Call a function while tracking whether the current task and its child
+  /// tasks record any unknown issues.
+  ///
+  /// - Parameters:
+  ///   - body: A function to call.
+  ///
+  /// - Returns: Whether or not an unknown issue was recorded while `body` ran.
+  ///
+  /// - Throws: Whatever is thrown by `body`.
+  ///
+  /// If the current task is already tracking unknown issues, issues recorded
+  /// while `body` runs are also tracked by the enclosing call to this function.
+  static func recordingUnknownIssues(during body: () async throws -> Void) async rethrows -> Bool {
+    let unknownIssueRecorded = Locked(rawValue: false)
+    var runtimeState = Runner.RuntimeState.current ?? .init()
+    let enclosingUnknownIssueRecorded = runtimeState.unknownIssueRecorded
+    runtimeState.unknownIssueRecorded = unknownIssueRecorded
+    try await Runner.RuntimeState.$current.withValue(runtimeState, operation: body)
+
+    let result = unknownIssueRecorded.rawValue
+    if result {
+      enclosingUnknownIssueRecorded?.withLock { enclosingUnknownIssueRecorded in
+        enclosingUnknownIssueRecorded = true
+      }
+    }
+    return result
+  }
+
+  /// Note that the current task recorded an unknown issue.
+  ///
+  /// If the current task is not tracking unknown issues, this function has no
+  /// effect.
+  static func noteUnknownIssueRecorded() {
+    Runner.RuntimeState.current?.unknownIssueRecorded?.withLock { unknownIssueRecorded in
+      unknownIssueRecorded = true
+    }
+  }
+}
+
+// MARK: - Allocation tracking
+
+extension Event.AllocationCounts {
+  /// Initialize an instance of this type from the counts reported by
+  /// `_TestingInternals`.
+  ///
+  /// - Parameters:
+  ///   - counts: The counts to convert.
+  fileprivate init(_ counts: SWTAllocationCounts) {
+    self.init(
+      allocationCount: Int(clamping: counts.allocationCount),
+      deallocationCount: Int(clamping: counts.deallocationCount),
+      allocatedByteCount: Int(clamping: counts.allocatedByteCount),
+      deallocatedByteCount: Int(clamping: counts.deallocatedByteCount)
+    )
+  }
+
+  /// Whether or not the testing library can track heap allocations in the
+  /// current process.
+  static var isTrackingAvailable: Bool {
+    swt_allocationTrackingIsAvailable()
+  }
+
+  /// Call a function while collecting the heap allocations tracked by the
+  /// current task and its child tasks.
+  ///
+  /// - Parameters:
+  ///   - body: A function to call.
+  ///
+  /// - Returns: Whatever is returned by `body`, and the allocations most
+  ///   recently tracked by ``tracking(for:during:)`` while `body` ran, if any.
+  static func collecting<R>(during body: () async -> R) async -> (R, Self?) {
+    let allocationCounts = Locked<Self?>(rawValue: nil)
+    var runtimeState = Runner.RuntimeState.current ?? .init()
+    runtimeState.allocationCounts = allocationCounts
+    let result = await Runner.RuntimeState.$current.withValue(runtimeState, operation: body)
+    return (result, allocationCounts.rawValue)
+  }
+
+  /// Call a function while tracking the heap allocations made by the current
+  /// thread.
+  ///
+  /// - Parameters:
+  ///   - test: The test whose body `body` runs.
+  ///   - body: A function to call.
+  ///
+  /// - Returns: Whatever is returned by `body`.
+  ///
+  /// - Throws: Whatever is thrown by `body`.
+  ///
+  /// If the current task is not collecting allocations (see
+  /// ``collecting(during:)``) or allocation tracking is not available, this
+  /// function calls `body` without tracking it. Otherwise, the tracked
+  /// allocations replace any previously collected by the current task and are
+  /// checked against the allocation budget of `test`, if any. If `body`
+  /// finishes on a different thread than it started on, the tracked
+  /// allocations are incomplete and are discarded.
+  ///
+  /// If `test` has an allocation budget that cannot be checked for either of
+  /// these reasons, a known issue is recorded to say so.
+  ///
+  /// Tracking remains armed on the starting thread while `body` is suspended,
+  /// so allocations made by other tasks on that thread are counted too. Test
+  /// cases of tests with an allocation budget run in isolation (see
+  /// ``Test/isIsolated``) so that no other test cases can run meanwhile.
+  static func tracking<R>(for test: Test, during body: () async throws -> R) async rethrows -> R {
+    guard let allocationCounts = Runner.RuntimeState.current?.allocationCounts else {
+      return try await body()
+    }
+    guard let token = swt_allocationTrackingBegin() else {
+      test.allocationBudget?.recordUnchecked(because: "allocation tracking is not available in this build of the testing library", for: test)
+      return try await body()
+    }
+    defer {
+      var counts = SWTAllocationCounts()
+      let isComplete = swt_allocationTrackingEnd(token, &counts)
+      let result = isComplete ? Self(counts) : nil
+      allocationCounts.withLock { allocationCounts in
+        allocationCounts = result
+      }
+      if let allocationBudget = test.allocationBudget {
+        if let result {
+          allocationBudget.check(result, for: test)
+        } else {
+          allocationBudget.recordUnchecked(because: "the test case resumed on a different thread after suspending", for: test)
+        }
+      }
+    }
+    return try await body()
+  }
+}
+
 /// Get the current test and test case in a single operation.
 ///
 /// - Returns: The current test and test case.
@@ -20,6 +20,20 @@ public struct Runner: Sendable {
   /// The runner's configuration.
   public var configuration: Configuration
 
+  /// The gate used to run test cases in isolation, if any tests in this
+  /// runner's plan require it.
+  ///
+  /// The value of this property is set when the runner starts running.
+  var isolationGate: IsolationGate?
+
+  /// The test cases that failed during the current iteration of the test plan
+  /// and should be retried, if failed test cases are being retried.
+  ///
+  /// The value of this property is set when the runner starts running if its
+  /// configuration's ``Configuration/retryPolicy-swift.property`` property is
+  /// not `nil`.
+  var failedTestCases: Locked<[(step: Plan.Step, testCase: Test.Case)]>?
+
   /// Initialize an instance of this type that runs the specified series of
   /// tests.
   ///
@@ -308,7 +322,135 @@ extension Runner {
     }
 
     try await _forEach(in: testCases, for: step) { testCase in
-      try await _runTestCase(testCase, within: step)
+      try await _notingFailure(of: testCase, within: step) {
+        if let isolationGate {
+          try await isolationGate.withAccess(exclusive: step.test.isIsolated) {
+            try await _runTestCase(testCase, within: step)
+          }
+        } else {
+          try await _runTestCase(testCase, within: step)
+        }
+      }
+    }
+  }
+
+  /// Call a function that runs a test case and, if the test case records an
+  /// unknown issue, note that it should be retried.
+  ///
+  /// - Parameters:
+  ///   - testCase: The test case that `body` runs.
+  ///   - step: The runner plan step associated with this test case.
+  ///   - body: A function that runs `testCase`.
+  ///
+  /// - Throws: Whatever is thrown by `body`.
+  ///
+  /// If failed test cases are not being retried, this function calls `body`
+  /// without tracking the issues it records.
+  private func _notingFailure(of testCase: Test.Case, within step: Plan.Step, _ body: () async throws -> Void) async throws {
+    guard let failedTestCases else {
+      return try await body()
+    }
+
+    if try await Issue.recordingUnknownIssues(during: body) {
+      failedTestCases.withLock { failedTestCases in
+        failedTestCases.append((step, testCase))
+      }
+    }
+  }
+
+  /// Retry the test cases that failed during the current iteration of the test
+  /// plan.
+  ///
+  /// Failed test cases are retried one at a time, in the order in which they
+  /// failed, according to the policy described by this runner's
+  /// ``Configuration/retryPolicy-swift.property`` property. An event of kind
+  /// ``Event/Kind-swift.enum/testCaseRetried(_:)`` is posted for each one.
+  ///
+  /// Because the tests these test cases belong to have already ended, the
+  /// events posted while they are retried are not delivered to this runner's
+  /// event handler. The unknown issues recorded by failed retries are instead
+  /// described by the event of kind
+  /// ``Event/Kind-swift.enum/testCaseRetried(_:)``.
+  private func _retryFailedTestCases() async {
+    guard let retryPolicy = configuration.retryPolicy, let failedTestCases else {
+      return
+    }
+    let testCasesToRetry = failedTestCases.withLock { failedTestCases in
+      defer {
+        failedTestCases.removeAll()
+      }
+      return failedTestCases
+    }
+
+    for (step, testCase) in testCasesToRetry {
+      if Task.isCancelled {
+        return
+      }
+
+      let failureDescriptions = Locked<[String]>(rawValue: [])
+      var retryRunner = self
+      retryRunner.failedTestCases = nil
+      retryRunner.configuration.flakeHuntingPolicy = nil
+      retryRunner.configuration.eventHandler = { event, _ in
+        if case let .issueRecorded(issue) = event.kind, !issue.isKnown {
+          failureDescriptions.withLock { failureDescriptions in
+            failureDescriptions.append(String(describingForTest: issue))
+          }
+        }
+      }
+
+      var retryCount = 0
+      var passed = false
+      await Configuration.withCurrent(retryRunner.configuration) {
+        repeat {
+          retryCount += 1
+          let failed = await Issue.recordingUnknownIssues {
+            await retryRunner._retry(testCase, within: step, inNewProcess: retryPolicy.retriesInNewProcess)
+          }
+          passed = !failed
+        } while !passed && retryCount < retryPolicy.maximumRetryCount && !Task.isCancelled
+      }
+
+      let result = Configuration.RetryPolicy.Result(
+        verdict: passed ? .flaky : .consistentlyFailing,
+        retryCount: retryCount,
+        failureDescriptions: failureDescriptions.rawValue
+      )
+      Event.post(.testCaseRetried(result), for: (step.test, testCase), configuration: configuration)
+    }
+  }
+
+  /// Run a failed test case again.
+  ///
+  /// - Parameters:
+  ///   - testCase: The test case to run.
+  ///   - step: The runner plan step associated with this test case.
+  ///   - inNewProcess: Whether or not to run `testCase` in a new process.
+  ///
+  /// The custom execution traits of the test that `testCase` belongs to are
+  /// applied, but those of its containing suites are not.
+  private func _retry(_ testCase: Test.Case, within step: Plan.Step, inNewProcess: Bool) async {
+    await Test.withCurrent(step.test) {
+#if !SWT_NO_EXIT_TESTS
+      // A test case can only be found in a new process if the IDs of its
+      // arguments are stable across processes.
+      if inNewProcess, testCase.id.argumentIDs != nil {
+        Event.post(.testCaseStarted, for: (step.test, testCase), configuration: configuration)
+        defer {
+          Event.post(.testCaseEnded, for: (step.test, testCase), configuration: configuration)
+        }
+        await Test.Case.withCurrent(testCase) {
+          await ExitTest.retry(testCase, of: step.test, configuration: configuration)
+        }
+        return
+      }
+#endif
+
+      _ = await Issue.withErrorRecording(at: step.test.sourceLocation, configuration: configuration) {
+        try await _executeTraits(for: step, testCase: nil) {
+          try await _runTestCase(testCase, within: step)
+        }
+      }
     }
   }
 
@@ -328,24 +470,78 @@ extension Runner {
     try Task.checkCancellation()
 
     Event.post(.testCaseStarted, for: (step.test, testCase), configuration: configuration)
+    var expectationCounts: Event.ExpectationCounts?
+    var allocationCounts: Event.AllocationCounts?
     defer {
-      Event.post(.testCaseEnded, for: (step.test, testCase), configuration: configuration)
+      Event.post(.testCaseEnded, for: (step.test, testCase), expectationCounts: expectationCounts, allocationCounts: allocationCounts, configuration: configuration)
+    }
+
+    func runTestCaseBody() async -> Event.ExpectationCounts? {
+      if configuration.countExpectationsChecked {
+        return await Event.ExpectationCounts.counting {
+          await huntingFlakes(in: testCase, within: step) {
+            await _runTestCaseBody(testCase, within: step)
+          }
+        }
+      }
+      await huntingFlakes(in: testCase, within: step) {
+        await _runTestCaseBody(testCase, within: step)
+      }
+      return nil
+    }
+
+    if configuration.trackAllocations || step.test.allocationBudget != nil {
+      (expectationCounts, allocationCounts) = await Event.AllocationCounts.collecting(during: runTestCaseBody)
+    } else {
+      expectationCounts = await runTestCaseBody()
     }
+  }
 
+  /// Run the body of a test case.
+  ///
+  /// - Parameters:
+  ///   - testCase: The test case to run.
+  ///   - step: The runner plan step associated with this test case.
+  ///
+  /// This function sets ``Test/Case/current``, then invokes the test case's
+  /// body closure. Errors thrown by the test case's body are recorded as
+  /// issues. If ``Configuration/performanceBaselines`` is set, the duration of
+  /// the test case is measured against its baseline. If allocations are being
+  /// collected for the test case, they are tracked while its body runs, and if
+  /// ``Configuration/measurePerformanceCounters`` is `true`, its body's
+  /// performance counters are measured. If ``Configuration/profileTestCases``
+  /// is `true`, its body's call stacks are sampled.
+  ///
+  /// Allocations, performance counters, and call stacks are measured around
+  /// the test case's custom execution traits rather than inside them, so that
+  /// each test case is measured exactly once even if a trait (such as
+  /// ``BenchmarkTrait``) calls its body many times.
+  private func _runTestCaseBody(_ testCase: Test.Case, within step: Plan.Step) async {
     await Test.Case.withCurrent(testCase) {
       let sourceLocation = step.test.sourceLocation
-      await Issue.withErrorRecording(at: sourceLocation, configuration: configuration) {
-        try await withTimeLimit(for: step.test, configuration: configuration) {
-          try await _executeTraits(for: step, testCase: testCase) {
-            try await testCase.body()
+      await measuringPerformance(of: testCase, within: step) {
+        await Issue.withErrorRecording(at: sourceLocation, configuration: configuration) {
+          try await withTimeLimit(for: step.test, configuration: configuration) {
+            try await measuringPerformanceCounters {
+              try await profiling {
+                try await Event.AllocationCounts.tracking(for: step.test) {
+                  try await _executeTraits(for: step, testCase: testCase) {
+                    try await testCase.body()
+                  }
+                }
+              }
+            }
+          } timeoutHandler: { timeLimit in
+            var issue = Issue(
+              kind: .timeLimitExceeded(timeLimitComponents: timeLimit),
+              comments: [],
+              sourceContext: .init(backtrace: .current(), sourceLocation: sourceLocation)
+            )
+            // The backtrace of this (timer) task does not show where the test
+            // is stuck, so capture the backtraces of every other thread too.
+            issue.threadBacktraces = Backtrace.allOtherThreads()
+            issue.record(configuration: configuration)
           }
-        } timeoutHandler: { timeLimit in
-          let issue = Issue(
-            kind: .timeLimitExceeded(timeLimitComponents: timeLimit),
-            comments: [],
-            sourceContext: .init(backtrace: .current(), sourceLocation: sourceLocation)
-          )
-          issue.record(configuration: configuration)
         }
       }
     }
@@ -369,6 +565,12 @@ extension Runner {
   private static func _run(_ runner: Self) async {
     var runner = runner
     runner.configureEventHandlerRuntimeState()
+    if runner.plan.steps.contains(where: \.test.isIsolated) {
+      runner.isolationGate = IsolationGate()
+    }
+    if runner.configuration.retryPolicy != nil {
+      runner.failedTestCases = Locked(rawValue: [])
+    }
 
     // Track whether or not any issues were recorded across the entire run.
     let issueRecorded = Locked(rawValue: false)
@@ -407,6 +609,10 @@ extension Runner {
           await taskGroup.waitForAll()
         }
 
+        // Retry any test cases that failed during this iteration now that no
+        // other tests are running.
+        await runner._retryFailedTestCases()
+
         // Determine if the test plan should iterate again. (The iteration count
         // is handled by the outer for-loop.)
         let shouldContinue = switch repetitionPolicy.continuationCondition {
@@ -0,0 +1,128 @@
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for Swift project authors
+//
+
+private import _TestingInternals
+
+/// A type describing the call stacks sampled while a test case ran.
+///
+/// A test case is only profiled when ``Configuration/profileTestCases`` is
+/// `true`. Profiling is currently only supported on Linux.
+@_spi(Experimental)
+public struct SamplingProfile: Sendable, Codable, Equatable {
+  /// The number of times each distinct call stack was sampled.
+  ///
+  /// The first address in each backtrace is that of the code that was running
+  /// when the sample was taken.
+  public var sampleCounts: [Backtrace: Int]
+
+  /// The number of samples that were taken but not recorded because the
+  /// profiler ran out of storage for them.
+  public var droppedSampleCount: Int
+
+  /// The total number of samples recorded.
+  public var sampleCount: Int {
+    sampleCounts.values.reduce(0, +)
+  }
+}
+
+// MARK: - Profiling
+
+extension SamplingProfile {
+  /// The amount of CPU time the process consumes between samples, in
+  /// microseconds.
+  static let sampleIntervalMicroseconds: UInt32 = 1_000
+}
+
+extension Runner {
+  /// Call a function while sampling its call stacks, then post them as an
+  /// event.
+  ///
+  /// - Parameters:
+  ///   - body: A function to call.
+  ///
+  /// - Returns: Whatever is returned by `body`.
+  ///
+  /// - Throws: Whatever is thrown by `body`.
+  ///
+  /// If ``Configuration/profileTestCases`` is `false`, this function calls
+  /// `body` without profiling it. Otherwise, an event of kind
+  /// ``Event/Kind-swift.enum/testCaseProfiled(_:)`` is posted for the current
+  /// test case after `body` returns or throws.
+  ///
+  /// The profiler samples every thread in the process, so only one test case
+  /// can be profiled at a time. If another test case is already being
+  /// profiled, `body` is called without profiling it.
+  func profiling<R>(_ body: () async throws -> R) async rethrows -> R {
+    guard configuration.profileTestCases,
+          swt_profilerStart(SamplingProfile.sampleIntervalMicroseconds) else {
+      return try await body()
+    }
+    defer {
+      var profile = SamplingProfile(sampleCounts: [:], droppedSampleCount: 0)
+      withUnsafeMutablePointer(to: &profile) { profile in
+        swt_profilerStop({ samples, sampleCount, droppedSampleCount, context in
+          let profile = context!.assumingMemoryBound(to: SamplingProfile.self)
+          for sample in UnsafeBufferPointer(start: samples, count: sampleCount) {
+            let backtrace = Backtrace(addresses: UnsafeBufferPointer(start: sample.addresses, count: sample.addressCount))
+            profile.pointee.sampleCounts[backtrace, default: 0] += 1
+          }
+          profile.pointee.droppedSampleCount = droppedSampleCount
+        }, profile)
+      }
+      Event.post(.testCaseProfiled(profile), configuration: configuration)
+    }
+    return try await body()
+  }
+}
+
+// MARK: - Formatting
+
+extension SamplingProfile {
+  /// A human-readable summary of this profile.
+  var summary: String {
+    if droppedSampleCount > 0 {
+      return "\(sampleCount.counting("sample")) of \(sampleCounts.count.counting("call stack")) (\(droppedSampleCount) dropped)"
+    }
+    return "\(sampleCount.counting("sample")) of \(sampleCounts.count.counting("call stack"))"
+  }
+
+  /// Get the call stacks in this profile in the "folded" format used to
+  /// generate flame graphs.
+  ///
+  /// - Parameters:
+  ///   - rootFrame: The name of a frame to insert at the root of each call
+  ///     stack, such as the ID of the test that was profiled.
+  ///   - symbolicationMode: How to symbolicate the addresses in each call
+  ///     stack.
+  ///
+  /// - Returns: A dictionary whose keys are call stacks, with frame names
+  ///   separated by semicolons starting from `rootFrame`, and whose values are
+  ///   the number of times each call stack was sampled. Call stacks whose
+  ///   addresses symbolicate to the same names are merged.
+  ///
+  /// Addresses that cannot be symbolicated are represented by their
+  /// hexadecimal values.
+  func foldedStacks(under rootFrame: String, symbolicationMode: Backtrace.SymbolicationMode) -> [String: Int] {
+    func frameName(_ name: String) -> String {
+      // Semicolons separate frames, and newlines separate call stacks.
+      String(name.map { $0 == ";" || $0.isNewline ? "," : $0 })
+    }
+
+    var result = [String: Int]()
+    for (backtrace, count) in sampleCounts {
+      let frames = backtrace.symbolicate(symbolicationMode).reversed().map { frame in
+        frameName(frame.symbolName ?? "0x\(String(frame.address, radix: 16))")
+      }
+      let stack = CollectionOfOne(frameName(rootFrame)) + frames
+      result[stack.joined(separator: ";"), default: 0] += count
+    }
+    return result
+  }
+}
@@ -0,0 +1,168 @@
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for Swift project authors
+//
+
+/// A type describing how long each phase of starting a test run took.
+///
+/// An instance of this type is posted in an event of kind
+/// ``Event/Kind-swift.enum/startupMeasured(_:)`` by the testing library's
+/// entry point before the first test starts.
+@_spi(Experimental)
+public struct StartupProfile: Sendable, Codable {
+  /// An enumeration describing the phases of starting a test run.
+  public enum Phase: String, Sendable, Codable {
+    /// Command-line arguments were parsed.
+    case argumentParsing
+
+    /// A configuration was created from the command-line arguments.
+    case configuration
+
+    /// Tests were discovered in the current process.
+    case discovery
+
+    /// The runner plan was constructed.
+    ///
+    /// This phase includes the ``filtering``, ``traitPreparation``, and
+    /// ``testCaseEvaluation`` phases.
+    case planConstruction
+
+    /// The configuration's test filter was applied to the discovered tests.
+    case filtering
+
+    /// Traits were prepared for the tests that will run.
+    ///
+    /// Traits of sibling tests are prepared concurrently, so this phase's
+    /// duration is the total time spent across all tests and may exceed the
+    /// duration of ``planConstruction``.
+    case traitPreparation
+
+    /// The test cases of the tests that will run were evaluated.
+    ///
+    /// Test cases of sibling tests are evaluated concurrently, so this phase's
+    /// duration is the total time spent across all tests and may exceed the
+    /// duration of ``planConstruction``.
+    case testCaseEvaluation
+
+    /// Whether or not this phase is part of the ``planConstruction`` phase.
+    var isPartOfPlanConstruction: Bool {
+      switch self {
+      case .filtering, .traitPreparation, .testCaseEvaluation:
+        true
+      default:
+        false
+      }
+    }
+  }
+
+  /// A type describing the duration of one phase of starting a test run.
+  public struct Measurement: Sendable, Codable {
+    /// The phase that was measured.
+    public var phase: Phase
+
+    /// The duration of the phase, in nanoseconds.
+    public var nanoseconds: Int
+  }
+
+  /// The measured phases, in the order they were first measured.
+  public var measurements: [Measurement] = []
+
+  /// The total duration, in nanoseconds, of the measured phases.
+  ///
+  /// Phases that are part of ``Phase/planConstruction`` are not counted
+  /// separately.
+  public var totalNanoseconds: Int {
+    measurements.lazy
+      .filter { !$0.phase.isPartOfPlanConstruction }
+      .map(\.nanoseconds)
+      .reduce(0, +)
+  }
+}
+
+// MARK: - Measuring
+
+extension StartupProfile {
+  /// Add time spent in a phase to this profile.
+  ///
+  /// - Parameters:
+  ///   - nanoseconds: The number of nanoseconds spent in `phase`.
+  ///   - phase: The phase that was measured.
+  ///
+  /// If `phase` was already measured, `nanoseconds` is added to its existing
+  /// duration.
+  mutating func add(_ nanoseconds: Int, to phase: Phase) {
+    if let index = measurements.firstIndex(where: { $0.phase == phase }) {
+      measurements[index].nanoseconds += nanoseconds
+    } else {
+      measurements.append(Measurement(phase: phase, nanoseconds: nanoseconds))
+    }
+  }
+
+  /// Call a function and add the time it took to this profile.
+  ///
+  /// - Parameters:
+  ///   - phase: The phase that `body` performs.
+  ///   - body: The function to call.
+  ///
+  /// - Returns: Whatever is returned by `body`.
+  ///
+  /// - Throws: Whatever is thrown by `body`.
+  mutating func measure<R>(_ phase: Phase, _ body: () async throws -> R) async rethrows -> R {
+    let startInstant = Test.Clock.Instant.now
+    defer {
+      add(Int(startInstant.nanoseconds(until: .now)), to: phase)
+    }
+    return try await body()
+  }
+}
+
+// MARK: - Formatting
+
+extension StartupProfile.Phase {
+  /// A human-readable name for this phase.
+  var name: String {
+    switch self {
+    case .argumentParsing:
+      "argument parsing"
+    case .configuration:
+      "configuration"
+    case .discovery:
+      "discovery"
+    case .planConstruction:
+      "plan construction"
+    case .filtering:
+      "filtering"
+    case .traitPreparation:
+      "trait preparation"
+    case .testCaseEvaluation:
+      "test case evaluation"
+    }
+  }
+}
+
+extension StartupProfile {
+  /// A human-readable summary of this profile.
+  var summary: String {
+    func describe(_ measurement: Measurement) -> String {
+      "\(measurement.phase.name) \(BenchmarkTrait.Statistics.descriptionOfNanoseconds(Double(measurement.nanoseconds)))"
+    }
+
+    let planConstructionDetails = measurements.lazy
+      .filter(\.phase.isPartOfPlanConstruction)
+      .map(describe)
+    let components = measurements.lazy
+      .filter { !$0.phase.isPartOfPlanConstruction }
+      .map { measurement in
+        if measurement.phase == .planConstruction, !planConstructionDetails.isEmpty {
+          return "\(describe(measurement)) (\(planConstructionDetails.joined(separator: ", ")))"
+        }
+        return describe(measurement)
+      }
+    return components.joined(separator: ", ")
+  }
+}
@@ -207,7 +207,7 @@ extension Backtrace {
   /// same location.)
   ///
   /// Access to this dictionary is guarded by a lock.
-  private static let _errorMappingCache = Locked<[_ErrorMappingCacheKey: _ErrorMappingCacheEntry]>()
+  private static let _errorMappingCache = Locked<[_ErrorMappingCacheKey: _ErrorMappingCacheEntry]>(label: "Backtrace error mapping cache")
 
   /// The previous `swift_willThrow` handler, if any.
   private static let _oldWillThrowHandler = Locked<SWTWillThrowHandler?>()
@@ -428,3 +428,34 @@ extension Backtrace {
     }
   }
 }
+
+// MARK: - Backtraces of other threads
+
+extension Backtrace {
+  /// Get the backtraces of every other thread in the current process.
+  ///
+  /// - Parameters:
+  ///   - timeoutMilliseconds: How long to wait for threads to capture their
+  ///     backtraces.
+  ///
+  /// - Returns: The backtraces of the threads that responded in time, or `nil`
+  ///   if the backtraces of other threads cannot be captured on this platform.
+  ///
+  /// Unlike ``current(maximumAddressCount:)``, this function does not follow
+  /// suspended tasks, but it can find a thread that is blocked (for instance,
+  /// on a lock or a system call) when the task that is waiting on it cannot.
+  /// Each backtrace's most recent addresses are those of the signal handler
+  /// used to capture it.
+  static func allOtherThreads(timeoutMilliseconds: UInt32 = 1_000) -> [Self]? {
+    var result: [Self]?
+    withUnsafeMutablePointer(to: &result) { result in
+      _ = swt_withAllThreadBacktraces(timeoutMilliseconds, { backtraces, backtraceCount, context in
+        let result = context!.assumingMemoryBound(to: [Backtrace]?.self)
+        result.pointee = UnsafeBufferPointer(start: backtraces, count: backtraceCount).map { backtrace in
+          Backtrace(addresses: UnsafeBufferPointer(start: backtrace.addresses, count: backtrace.addressCount))
+        }
+      }, result)
+    }
+    return result
+  }
+}
@@ -17,3 +17,90 @@ extension CollectionDifference.Change {
     }
   }
 }
+
+// MARK: - Describing differences
+
+extension BidirectionalCollection where Element: Equatable {
+  /// Describe the difference between this collection and another one.
+  ///
+  /// - Parameters:
+  ///   - other: The collection to compare against.
+  ///   - maximumDiffedCount: The maximum combined number of elements, after
+  ///     trimming any prefix and suffix common to both collections, for which a
+  ///     full difference is computed.
+  ///   - maximumListedCount: The maximum number of inserted or removed elements
+  ///     to include in the resulting string.
+  ///
+  /// - Returns: A string describing the elements that would need to be
+  ///   inserted into and removed from `other` to produce `self`, or the empty
+  ///   string if the two collections are equal.
+  ///
+  /// Computing a `CollectionDifference` can take time quadratic in the lengths
+  /// of the collections when they differ substantially. This function first
+  /// trims the prefix and suffix the collections have in common, which is
+  /// linear and typically leaves only a small region to compare. If that
+  /// region is still larger than `maximumDiffedCount`, a summary of it is
+  /// described instead of a full difference.
+  func differenceDescription(from other: Self, maximumDiffedCount: Int = 2_000, maximumListedCount: Int = 50) -> String {
+    // Trim the common prefix.
+    var selfStart = startIndex
+    var otherStart = other.startIndex
+    while selfStart != endIndex && otherStart != other.endIndex && self[selfStart] == other[otherStart] {
+      formIndex(after: &selfStart)
+      other.formIndex(after: &otherStart)
+    }
+
+    // Trim the common suffix.
+    var selfEnd = endIndex
+    var otherEnd = other.endIndex
+    while selfEnd != selfStart && otherEnd != otherStart {
+      let selfLast = index(before: selfEnd)
+      let otherLast = other.index(before: otherEnd)
+      guard self[selfLast] == other[otherLast] else {
+        break
+      }
+      selfEnd = selfLast
+      otherEnd = otherLast
+    }
+
+    let selfMiddle = self[selfStart ..< selfEnd]
+    let otherMiddle = other[otherStart ..< otherEnd]
+
+    // Describe a list of elements, truncating it if it is too long.
+    func describe(_ elements: some Collection<Element>) -> String {
+      if elements.count <= maximumListedCount {
+        return String(describing: Array(elements))
+      }
+      return "\(Array(elements.prefix(maximumListedCount))) (and \(elements.count - maximumListedCount) more)"
+    }
+
+    let insertions: [Element]
+    let removals: [Element]
+    if selfMiddle.isEmpty || otherMiddle.isEmpty {
+      // Elements were only inserted or only removed (in one contiguous region),
+      // so there is no need to compute a difference.
+      insertions = Array(selfMiddle)
+      removals = Array(otherMiddle)
+    } else if selfMiddle.count + otherMiddle.count > maximumDiffedCount {
+      // Too many elements remain to compute a difference in a reasonable amount
+      // of time. Treat the entire differing region as having been replaced.
+      let offset = distance(from: startIndex, to: selfStart)
+      return "replaced \(otherMiddle.count) elements starting at offset \(offset) with \(selfMiddle.count) elements: inserted \(describe(selfMiddle)), removed \(describe(otherMiddle))"
+    } else {
+      let difference = selfMiddle.difference(from: otherMiddle)
+      insertions = difference.insertions.map(\.element)
+      removals = difference.removals.map(\.element)
+    }
+
+    switch (!insertions.isEmpty, !removals.isEmpty) {
+    case (true, true):
+      return "inserted \(describe(insertions)), removed \(describe(removals))"
+    case (true, false):
+      return "inserted \(describe(insertions))"
+    case (false, true):
+      return "removed \(describe(removals))"
+    case (false, false):
+      return ""
+    }
+  }
+}
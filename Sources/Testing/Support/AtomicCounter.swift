@@ -0,0 +1,87 @@
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for Swift project authors
+//
+
+internal import _TestingInternals
+
+/// A type that wraps an integer that may be read and modified concurrently
+/// without taking a lock.
+///
+/// Use this type instead of `Locked<Int>` for counters that are updated on hot
+/// paths such as checking an expectation. Its interface mirrors the integer
+/// conveniences available on ``Locked`` so that the two types are
+/// interchangeable for counting purposes. Reads and writes are atomic and
+/// sequentially consistent, but a sequence of calls is not (for instance,
+/// reading ``rawValue`` and then calling ``add(_:)`` is not a single atomic
+/// operation.) If a counter must be kept consistent with other state, use
+/// ``Locked`` instead.
+///
+/// This type is not part of the public interface of the testing library.
+struct AtomicCounter: RawRepresentable, Sendable {
+  /// Storage for the underlying integer.
+  ///
+  /// The header of a `ManagedBuffer` has a stable address for the lifetime of
+  /// the buffer, so it is suitable for use with the atomic functions in
+  /// `_TestingInternals`.
+  private nonisolated(unsafe) var _storage: ManagedBuffer<Int, Void>
+
+  init(rawValue: Int) {
+    _storage = .create(minimumCapacity: 0, makingHeaderWith: { _ in rawValue })
+  }
+
+  var rawValue: Int {
+    _storage.withUnsafeMutablePointerToHeader { swt_atomic_load($0) }
+  }
+
+  /// Add something to the current wrapped value of this instance.
+  ///
+  /// - Parameters:
+  ///   - addend: The value to add.
+  ///
+  /// - Returns: The sum of ``rawValue`` and `addend`.
+  @discardableResult func add(_ addend: Int) -> Int {
+    _storage.withUnsafeMutablePointerToHeader { rawValue in
+      swt_atomic_fetch_add(rawValue, addend) &+ addend
+    }
+  }
+
+  /// Replace the current wrapped value of this instance if it equals an
+  /// expected value.
+  ///
+  /// - Parameters:
+  ///   - expected: The value this instance is expected to have.
+  ///   - desired: The value to store in this instance if its current value is
+  ///     `expected`.
+  ///
+  /// - Returns: Whether or not `desired` was stored in this instance.
+  func compareExchange(expected: Int, desired: Int) -> Bool {
+    _storage.withUnsafeMutablePointerToHeader { rawValue in
+      var expected = expected
+      return swt_atomic_compare_exchange(rawValue, &expected, desired)
+    }
+  }
+
+  /// Increment the current wrapped value of this instance.
+  ///
+  /// - Returns: The sum of ``rawValue`` and `1`.
+  ///
+  /// This function is exactly equivalent to `add(1)`.
+  @discardableResult func increment() -> Int {
+    add(1)
+  }
+
+  /// Decrement the current wrapped value of this instance.
+  ///
+  /// - Returns: The sum of ``rawValue`` and `-1`.
+  ///
+  /// This function is exactly equivalent to `add(-1)`.
+  @discardableResult func decrement() -> Int {
+    add(-1)
+  }
+}
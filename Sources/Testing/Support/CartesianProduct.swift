@@ -50,6 +50,35 @@ struct CartesianProduct<C1, C2>: LazySequenceProtocol where C1: Collection, C2:
 
 extension CartesianProduct: Sendable where C1: Sendable, C2: Sendable {}
 
+// MARK: - Collection
+
+/// When both input collections support random access, so does their Cartesian
+/// product: the element at any offset can be computed in constant time without
+/// iterating over the preceding elements. This allows callers to split the
+/// product into evenly-sized chunks or jump directly to a given element.
+extension CartesianProduct: Collection, BidirectionalCollection, RandomAccessCollection where C1: RandomAccessCollection, C2: RandomAccessCollection {
+  typealias Index = Int
+
+  var startIndex: Int {
+    0
+  }
+
+  var endIndex: Int {
+    let (result, overflowed) = collection1.count.multipliedReportingOverflow(by: collection2.count)
+    precondition(!overflowed, "The Cartesian product of \(collection1.count) and \(collection2.count) elements is too large to index.")
+    return result
+  }
+
+  subscript(position: Int) -> Element {
+    precondition(position >= startIndex && position < endIndex, "Index \(position) is out of bounds.")
+    let (offset1, offset2) = position.quotientAndRemainder(dividingBy: collection2.count)
+    return (
+      collection1[collection1.index(collection1.startIndex, offsetBy: offset1)],
+      collection2[collection2.index(collection2.startIndex, offsetBy: offset2)]
+    )
+  }
+}
+
 /// Creates the Cartesian product of two collections.
 ///
 /// - Parameters:
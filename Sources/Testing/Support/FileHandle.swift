@@ -345,6 +345,34 @@ extension FileHandle {
 
     return result
   }
+
+  /// Read a line from the file handle.
+  ///
+  /// - Returns: A copy of the contents of the file handle starting at the
+  ///   current offset and ending before the next newline character, or `nil`
+  ///   if the end of the file was reached before any bytes were read.
+  ///
+  /// - Throws: Any error that occurred while reading the file.
+  ///
+  /// The newline character that ends the line is consumed but is not included
+  /// in the result.
+  func readLine() throws -> [UInt8]? {
+    try withUnsafeCFILEHandle { file in
+      var result = [UInt8]()
+      while true {
+        let byte = fgetc(file)
+        if byte == EOF {
+          if 0 != ferror(file) {
+            throw CError(rawValue: swt_errno())
+          }
+          return result.isEmpty ? nil : result
+        } else if byte == CInt(UInt8(ascii: "\n")) {
+          return result
+        }
+        result.append(UInt8(truncatingIfNeeded: byte))
+      }
+    }
+  }
 }
 
 // MARK: - Writing
@@ -440,6 +468,48 @@ extension FileHandle {
       }
     }
   }
+
+  /// Write a string to this file handle at a given offset, then return to the
+  /// previous offset.
+  ///
+  /// - Parameters:
+  ///   - string: The string to write.
+  ///   - offset: The offset, in bytes from the start of the file, at which to
+  ///     write `string`.
+  ///
+  /// - Throws: Any error that occurred while seeking or writing `string`.
+  ///
+  /// This function overwrites any bytes already present at `offset`. The file
+  /// handle must refer to a file that supports seeking, such as a regular file.
+  /// The file is locked while this function seeks and writes so that other
+  /// writes to it are not interleaved at the wrong offset.
+  func write(_ string: String, atOffset offset: Int64) throws {
+    try withLock {
+      try withUnsafeCFILEHandle { file in
+#if SWT_TARGET_OS_APPLE || os(Linux) || os(FreeBSD) || os(Android) || os(WASI)
+        let oldOffset = ftello(file)
+        guard oldOffset >= 0, 0 == fseeko(file, off_t(offset), SEEK_SET) else {
+          throw CError(rawValue: swt_errno())
+        }
+        defer {
+          _ = fseeko(file, oldOffset, SEEK_SET)
+        }
+#elseif os(Windows)
+        let oldOffset = _ftelli64(file)
+        guard oldOffset >= 0, 0 == _fseeki64(file, offset, SEEK_SET) else {
+          throw CError(rawValue: swt_errno())
+        }
+        defer {
+          _ = _fseeki64(file, oldOffset, SEEK_SET)
+        }
+#else
+#warning("Platform-specific implementation missing: cannot seek within a file")
+        throw SystemError(description: "Seeking within a file is not supported on this platform.")
+#endif
+        try write(string)
+      }
+    }
+  }
 }
 
 #if !SWT_NO_PIPES
@@ -529,6 +599,32 @@ extension FileHandle {
 #endif
   }
 
+  /// Is this file handle a regular file?
+  ///
+  /// Regular files support seeking, unlike pipes, TTYs, and other special
+  /// files.
+  var isRegularFile: Bool {
+#if SWT_TARGET_OS_APPLE || os(Linux) || os(FreeBSD) || os(Android) || os(WASI)
+    withUnsafePOSIXFileDescriptor { fd in
+      guard let fd else {
+        return false
+      }
+      var statStruct = stat()
+      return (0 == fstat(fd, &statStruct) && swt_S_ISREG(mode_t(statStruct.st_mode)))
+    }
+#elseif os(Windows)
+    return withUnsafeWindowsHANDLE { handle in
+      guard let handle else {
+        return false
+      }
+      return FILE_TYPE_DISK == GetFileType(handle)
+    }
+#else
+#warning("Platform-specific implementation missing: cannot tell if a file is a regular file")
+    return false
+#endif
+  }
+
 #if !SWT_NO_PIPES
   /// Is this file handle a pipe or FIFO?
   var isPipe: Bool {
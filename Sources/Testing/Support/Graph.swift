@@ -851,6 +851,227 @@ extension Graph {
   }
 }
 
+// MARK: - Concurrent functional programming
+
+extension Graph where K: Sendable, V: Sendable {
+  /// The recursive implementation of `concurrentForEach(maxConcurrentChildren:_:)`.
+  ///
+  /// - Parameters:
+  ///   - keyPath: The key path to use for the root node when passing it to
+  ///     `body`.
+  ///   - maxConcurrentChildren: The maximum number of child nodes of any one
+  ///     node that may be visited concurrently.
+  ///   - body: A closure that is invoked once per element in the graph. The
+  ///     key path and leaf value of each node are passed to the closure.
+  private func _concurrentForEach(keyPath: [K], maxConcurrentChildren: Int, _ body: @escaping @Sendable (Element) async -> Void) async {
+    await body((keyPath, value))
+
+    await withTaskGroup(of: Void.self) { taskGroup in
+      for (i, (key, child)) in children.enumerated() {
+        // Keep no more than maxConcurrentChildren child tasks in flight.
+        if i >= maxConcurrentChildren {
+          _ = await taskGroup.next()
+        }
+
+        var childKeyPath = keyPath
+        childKeyPath.append(key)
+        taskGroup.addTask {
+          await child._concurrentForEach(keyPath: childKeyPath, maxConcurrentChildren: maxConcurrentChildren, body)
+        }
+      }
+    }
+  }
+
+  /// Iterate over the nodes in a graph, visiting sibling nodes concurrently.
+  ///
+  /// - Parameters:
+  ///   - maxConcurrentChildren: The maximum number of child nodes of any one
+  ///     node that may be visited concurrently. By default, the number is
+  ///     unbounded and actual parallelism is limited by the Swift concurrency
+  ///     runtime.
+  ///   - body: A closure that is invoked once per element in the graph. The
+  ///     key path and leaf value of each node are passed to the closure.
+  ///
+  /// Each node is passed to `body` before any of its child nodes are, but the
+  /// order in which sibling nodes (and their descendants) are visited is
+  /// unspecified. Use ``forEach(_:)`` if `body` must be invoked serially.
+  func concurrentForEach(maxConcurrentChildren: Int = .max, _ body: @escaping @Sendable (Element) async -> Void) async {
+    precondition(maxConcurrentChildren > 0, "maxConcurrentChildren must be greater than 0 (was \(maxConcurrentChildren)).")
+    await _concurrentForEach(keyPath: [], maxConcurrentChildren: maxConcurrentChildren, body)
+  }
+
+  /// The recursive implementation of
+  /// `concurrentCompactMapValues(maxConcurrentChildren:_:)`.
+  ///
+  /// - Parameters:
+  ///   - keyPath: The key path to use for the root node when passing it to
+  ///     `transform`.
+  ///   - maxConcurrentChildren: The maximum number of child nodes of any one
+  ///     node that may be transformed concurrently.
+  ///   - transform: A closure that is invoked once per element in the graph.
+  ///     The key path and leaf value of each node are passed to this closure.
+  ///     The result of the closure is a tuple containing the new value and
+  ///     specifying whether or not the new value should also be applied to each
+  ///     descendant node. If `true`, `transform` is not invoked for those
+  ///     descendant nodes. If the result is `nil`, the node and all of its
+  ///     child nodes are omitted from the new graph.
+  private func _concurrentCompactMapValues<U>(
+    keyPath: [K],
+    maxConcurrentChildren: Int,
+    _ transform: @escaping @Sendable (Element) async -> (U, recursivelyApply: Bool)?
+  ) async -> Graph<K, U>? where U: Sendable {
+    guard let (newValue, recursivelyApply) = await transform((keyPath, value)) else {
+      return nil
+    }
+
+    // If the new value applies to all descendants, there is no more work for
+    // transform to do and nothing to gain by fanning out.
+    if recursivelyApply {
+      return mapValues { _ in newValue }
+    }
+
+    let newChildren = await withTaskGroup(of: (K, Graph<K, U>?).self, returning: [K: Graph<K, U>].self) { taskGroup in
+      var newChildren = [K: Graph<K, U>]()
+      newChildren.reserveCapacity(children.count)
+
+      for (i, (key, child)) in children.enumerated() {
+        // Keep no more than maxConcurrentChildren child tasks in flight.
+        if i >= maxConcurrentChildren, let (key, newChild) = await taskGroup.next() {
+          newChildren[key] = newChild
+        }
+
+        var childKeyPath = keyPath
+        childKeyPath.append(key)
+        taskGroup.addTask {
+          let newChild = await child._concurrentCompactMapValues(keyPath: childKeyPath, maxConcurrentChildren: maxConcurrentChildren, transform)
+          return (key, newChild)
+        }
+      }
+
+      // Results are joined by key, so the resulting graph does not depend on
+      // the order in which child tasks complete.
+      for await (key, newChild) in taskGroup {
+        newChildren[key] = newChild
+      }
+      return newChildren
+    }
+
+    return Graph<K, U>(value: newValue, children: newChildren)
+  }
+
+  /// Create a new graph containing only the nodes that have non-`nil` values as
+  /// the result of transformation by the given closure, transforming sibling
+  /// nodes concurrently.
+  ///
+  /// - Parameters:
+  ///   - maxConcurrentChildren: The maximum number of child nodes of any one
+  ///     node that may be transformed concurrently. By default, the number is
+  ///     unbounded and actual parallelism is limited by the Swift concurrency
+  ///     runtime.
+  ///   - transform: A closure that is invoked once per element in the graph.
+  ///     The key path and leaf value of each node are passed to this closure
+  ///     and its result is used as the corresponding value in the new graph. If
+  ///     the result is `nil`, the node and all of its child nodes are omitted
+  ///     from the new graph.
+  ///
+  /// - Returns: A graph containing the transformed nodes of this graph at the
+  ///   same key paths, with `nil` values omitted.
+  ///
+  /// Each node is passed to `transform` before any of its child nodes are, but
+  /// the order in which sibling nodes (and their descendants) are transformed
+  /// is unspecified. The resulting graph is the same as the one produced by
+  /// ``compactMapValues(_:)`` given the same transformation.
+  func concurrentCompactMapValues<U>(maxConcurrentChildren: Int = .max, _ transform: @escaping @Sendable (Element) async -> U?) async -> Graph<K, U>? where U: Sendable {
+    await concurrentCompactMapValues(maxConcurrentChildren: maxConcurrentChildren) { element -> (U, recursivelyApply: Bool)? in
+      await transform(element).map { ($0, false) }
+    }
+  }
+
+  /// Create a new graph containing only the nodes that have non-`nil` values as
+  /// the result of transformation by the given closure, with the option to
+  /// recursively apply said result to all descendants of each node,
+  /// transforming sibling nodes concurrently.
+  ///
+  /// - Parameters:
+  ///   - maxConcurrentChildren: The maximum number of child nodes of any one
+  ///     node that may be transformed concurrently. By default, the number is
+  ///     unbounded and actual parallelism is limited by the Swift concurrency
+  ///     runtime.
+  ///   - transform: A closure that is invoked once per element in the graph.
+  ///     The key path and leaf value of each node are passed to this closure.
+  ///     The result of the closure is a tuple containing the new value and
+  ///     specifying whether or not the new value should also be applied to each
+  ///     descendant node. If `true`, `transform` is not invoked for those
+  ///     descendant nodes. If the result is `nil`, the node and all of its
+  ///     child nodes are omitted from the new graph.
+  ///
+  /// - Returns: A graph containing the transformed nodes of this graph at the
+  ///   same key paths, with `nil` values omitted.
+  ///
+  /// Each node is passed to `transform` before any of its child nodes are, but
+  /// the order in which sibling nodes (and their descendants) are transformed
+  /// is unspecified. The resulting graph is the same as the one produced by
+  /// ``compactMapValues(_:)`` given the same transformation.
+  func concurrentCompactMapValues<U>(maxConcurrentChildren: Int = .max, _ transform: @escaping @Sendable (Element) async -> (U, recursivelyApply: Bool)?) async -> Graph<K, U>? where U: Sendable {
+    precondition(maxConcurrentChildren > 0, "maxConcurrentChildren must be greater than 0 (was \(maxConcurrentChildren)).")
+    return await _concurrentCompactMapValues(keyPath: [], maxConcurrentChildren: maxConcurrentChildren, transform)
+  }
+
+  /// Create a new graph containing the nodes of this graph with the values
+  /// transformed by the given closure, transforming sibling nodes
+  /// concurrently.
+  ///
+  /// - Parameters:
+  ///   - maxConcurrentChildren: The maximum number of child nodes of any one
+  ///     node that may be transformed concurrently. By default, the number is
+  ///     unbounded and actual parallelism is limited by the Swift concurrency
+  ///     runtime.
+  ///   - transform: A closure that is invoked once per element in the graph.
+  ///     The key path and leaf value of each node are passed to this closure
+  ///     and its result is used as the corresponding value in the new graph.
+  ///
+  /// - Returns: A graph containing the transformed nodes of this graph at the
+  ///   same key paths.
+  ///
+  /// Each node is passed to `transform` before any of its child nodes are, but
+  /// the order in which sibling nodes (and their descendants) are transformed
+  /// is unspecified. The resulting graph is the same as the one produced by
+  /// ``mapValues(_:)`` given the same transformation.
+  func concurrentMapValues<U>(maxConcurrentChildren: Int = .max, _ transform: @escaping @Sendable (Element) async -> U) async -> Graph<K, U> where U: Sendable {
+    await concurrentCompactMapValues(maxConcurrentChildren: maxConcurrentChildren) { element -> (U, recursivelyApply: Bool)? in
+      await (transform(element), false)
+    }!
+  }
+
+  /// Create a new graph containing the nodes of this graph with the values
+  /// transformed by the given closure, with the option to recursively apply
+  /// the result of that transformation to all descendants of each node,
+  /// transforming sibling nodes concurrently.
+  ///
+  /// - Parameters:
+  ///   - maxConcurrentChildren: The maximum number of child nodes of any one
+  ///     node that may be transformed concurrently. By default, the number is
+  ///     unbounded and actual parallelism is limited by the Swift concurrency
+  ///     runtime.
+  ///   - transform: A closure that is invoked once per element in the graph.
+  ///     The key path and leaf value of each node are passed to this closure.
+  ///     The result of the closure is a tuple containing the new value and
+  ///     specifying whether or not the new value should also be applied to each
+  ///     descendant node. If `true`, `transform` is not invoked for those
+  ///     descendant nodes.
+  ///
+  /// - Returns: A graph containing the transformed nodes of this graph at the
+  ///   same key paths.
+  ///
+  /// Each node is passed to `transform` before any of its child nodes are, but
+  /// the order in which sibling nodes (and their descendants) are transformed
+  /// is unspecified. The resulting graph is the same as the one produced by
+  /// ``mapValues(_:)`` given the same transformation.
+  func concurrentMapValues<U>(maxConcurrentChildren: Int = .max, _ transform: @escaping @Sendable (Element) async -> (U, recursivelyApply: Bool)) async -> Graph<K, U> where U: Sendable {
+    await concurrentCompactMapValues(maxConcurrentChildren: maxConcurrentChildren, transform)!
+  }
+}
+
 /// Creates a graph whose values are pairs built out of two underlying graphs.
 ///
 /// - Parameters:
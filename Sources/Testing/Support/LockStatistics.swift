@@ -0,0 +1,122 @@
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for Swift project authors
+//
+
+/// A type that records how often an instance of ``Locked`` is acquired and how
+/// long callers wait to acquire it.
+///
+/// Statistics are only recorded for instances of ``Locked`` that are given a
+/// label when they are created, and only if the `SWT_LOCK_STATISTICS_ENABLED`
+/// environment variable is set to a truthy value when the first such instance
+/// is created. When statistics are enabled, the testing library's entry point
+/// writes a summary of them to the standard error stream after running tests.
+///
+/// This type is not part of the public interface of the testing library.
+final class LockStatistics: Sendable {
+  /// The label of the lock.
+  let label: String
+
+  /// The number of times the lock has been acquired.
+  let acquisitionCount = AtomicCounter(rawValue: 0)
+
+  /// The number of times the lock was already held when a caller attempted to
+  /// acquire it.
+  let contendedAcquisitionCount = AtomicCounter(rawValue: 0)
+
+  /// The total time, in nanoseconds, that callers have spent waiting to acquire
+  /// the lock.
+  let waitNanoseconds = AtomicCounter(rawValue: 0)
+
+  /// Initialize an instance of this type.
+  ///
+  /// - Parameters:
+  ///   - label: The label of the lock.
+  ///
+  /// Instances created with this initializer are not included in ``summary``.
+  /// To create an instance for a new lock, use ``make(label:)``.
+  init(label: String) {
+    self.label = label
+  }
+
+  /// Whether or not lock statistics are recorded in the current process.
+  static let isEnabled = Environment.flag(named: "SWT_LOCK_STATISTICS_ENABLED") == true
+
+  /// All instances of this type created in the current process.
+  ///
+  /// The lock guarding this property is not itself labeled, so its use is not
+  /// recorded.
+  private static let _all = Locked<[LockStatistics]>(rawValue: [])
+
+  /// Create an instance of this type for a newly-created lock.
+  ///
+  /// - Parameters:
+  ///   - label: The label of the lock.
+  ///
+  /// - Returns: A new instance of this type, or `nil` if lock statistics are
+  ///   not enabled.
+  static func make(label: String) -> LockStatistics? {
+    guard isEnabled else {
+      return nil
+    }
+    let result = LockStatistics(label: label)
+    _all.withLock { $0.append(result) }
+    return result
+  }
+
+  /// Acquire a lock and record statistics about the acquisition.
+  ///
+  /// - Parameters:
+  ///   - tryAcquire: A function that attempts to acquire the lock without
+  ///     blocking and returns whether or not it succeeded.
+  ///   - acquire: A function that acquires the lock, blocking if necessary.
+  func acquire(trying tryAcquire: () -> Bool, orBlocking acquire: () -> Void) {
+    acquisitionCount.increment()
+    if tryAcquire() {
+      return
+    }
+    contendedAcquisitionCount.increment()
+    let start = Test.Clock.Instant.now
+    acquire()
+    waitNanoseconds.add(Int(start.nanoseconds(until: .now)))
+  }
+}
+
+// MARK: - Reporting
+
+extension LockStatistics {
+  /// A human-readable summary of the statistics recorded for all labeled
+  /// locks in the current process, or `nil` if lock statistics are not
+  /// enabled.
+  ///
+  /// Locks are listed in descending order of total wait time. Locks that share
+  /// a label (such as the shards of a sharded cache) are combined.
+  static var summary: String? {
+    guard isEnabled else {
+      return nil
+    }
+
+    var acquisitions = [String: (count: Int, contendedCount: Int, waitNanoseconds: Int)]()
+    for statistics in _all.rawValue {
+      var entry = acquisitions[statistics.label] ?? (0, 0, 0)
+      entry.count += statistics.acquisitionCount.rawValue
+      entry.contendedCount += statistics.contendedAcquisitionCount.rawValue
+      entry.waitNanoseconds += statistics.waitNanoseconds.rawValue
+      acquisitions[statistics.label] = entry
+    }
+
+    let lines = acquisitions
+      .sorted { lhs, rhs in
+        (lhs.value.waitNanoseconds, rhs.key) > (rhs.value.waitNanoseconds, lhs.key)
+      }.map { label, entry in
+        let waitMilliseconds = Double(entry.waitNanoseconds) / 1_000_000.0
+        return "  \(label): \(entry.count) acquisitions, \(entry.contendedCount) contended, \(waitMilliseconds) ms waiting"
+      }
+    return "Lock statistics:\n\(lines.joined(separator: "\n"))\n"
+  }
+}
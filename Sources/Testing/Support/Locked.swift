@@ -35,7 +35,14 @@ struct Locked<T>: RawRepresentable, Sendable where T: Sendable {
   ///
   /// To keep the implementation of this type as simple as possible,
   /// `pthread_mutex_t` is used on Apple platforms instead of `os_unfair_lock`
-  /// or `OSAllocatedUnfairLock`.
+  /// or `OSAllocatedUnfairLock`. On Linux, the mutex is initialized as an
+  /// adaptive mutex that spins briefly before waiting on a futex, which avoids
+  /// entering the kernel for short, contended critical sections. A hand-rolled
+  /// futex lock is not used because ``withUnsafeUnderlyingLock(_:)`` must
+  /// produce a lock that is compatible with `pthread_cond_wait()`.
+  ///
+  /// For integer counters that do not need to be consistent with other state,
+  /// use ``AtomicCounter`` instead of this type.
 #if SWT_TARGET_OS_APPLE || os(Linux) || os(FreeBSD) || os(Android) || (os(WASI) && compiler(>=6.1) && _runtime(_multithreaded))
   private typealias _Lock = pthread_mutex_t
 #elseif os(Windows)
@@ -68,10 +75,30 @@ struct Locked<T>: RawRepresentable, Sendable where T: Sendable {
   /// Storage for the underlying lock and wrapped value.
   private nonisolated(unsafe) var _storage: ManagedBuffer<T, _Lock>
 
+  /// Statistics about the use of this instance, if it was created with a label
+  /// while lock statistics are enabled.
+  private let _statistics: LockStatistics?
+
   init(rawValue: T) {
+    self.init(rawValue: rawValue, label: nil)
+  }
+
+  /// Initialize an instance of this type.
+  ///
+  /// - Parameters:
+  ///   - rawValue: The initial value of the new instance.
+  ///   - label: A human-readable label for the new instance. If not `nil` and
+  ///     lock statistics are enabled, acquisitions of the new instance's lock
+  ///     are recorded and reported under this label.
+  ///
+  /// For more information about lock statistics, see ``LockStatistics``.
+  init(rawValue: T, label: String?) {
     _storage = _Storage.create(minimumCapacity: 1, makingHeaderWith: { _ in rawValue })
+    _statistics = label.flatMap(LockStatistics.make(label:))
     _storage.withUnsafeMutablePointerToElements { lock in
-#if SWT_TARGET_OS_APPLE || os(Linux) || os(FreeBSD) || os(Android) || (os(WASI) && compiler(>=6.1) && _runtime(_multithreaded))
+#if os(Linux)
+      _ = swt_pthread_mutex_init_adaptive_np(lock)
+#elseif SWT_TARGET_OS_APPLE || os(FreeBSD) || os(Android) || (os(WASI) && compiler(>=6.1) && _runtime(_multithreaded))
       _ = pthread_mutex_init(lock, nil)
 #elseif os(Windows)
       InitializeSRWLock(lock)
@@ -102,12 +129,26 @@ struct Locked<T>: RawRepresentable, Sendable where T: Sendable {
   nonmutating func withLock<R>(_ body: (inout T) throws -> R) rethrows -> R {
     try _storage.withUnsafeMutablePointers { rawValue, lock in
 #if SWT_TARGET_OS_APPLE || os(Linux) || os(FreeBSD) || os(Android) || (os(WASI) && compiler(>=6.1) && _runtime(_multithreaded))
-      _ = pthread_mutex_lock(lock)
+      if let _statistics {
+        _statistics.acquire(
+          trying: { 0 == pthread_mutex_trylock(lock) },
+          orBlocking: { _ = pthread_mutex_lock(lock) }
+        )
+      } else {
+        _ = pthread_mutex_lock(lock)
+      }
       defer {
         _ = pthread_mutex_unlock(lock)
       }
 #elseif os(Windows)
-      AcquireSRWLockExclusive(lock)
+      if let _statistics {
+        _statistics.acquire(
+          trying: { 0 != TryAcquireSRWLockExclusive(lock) },
+          orBlocking: { AcquireSRWLockExclusive(lock) }
+        )
+      } else {
+        AcquireSRWLockExclusive(lock)
+      }
       defer {
         ReleaseSRWLockExclusive(lock)
       }
@@ -190,12 +231,20 @@ extension Locked where T: Numeric {
 
 extension Locked {
   /// Initialize an instance of this type with a raw value of `nil`.
-  init<V>() where T == V? {
-    self.init(rawValue: nil)
+  ///
+  /// - Parameters:
+  ///   - label: A human-readable label for the new instance. For more
+  ///     information, see ``init(rawValue:label:)``.
+  init<V>(label: String? = nil) where T == V? {
+    self.init(rawValue: nil, label: label)
   }
 
   /// Initialize an instance of this type with a raw value of `[:]`.
-  init<K, V>() where T == Dictionary<K, V> {
-    self.init(rawValue: [:])
+  ///
+  /// - Parameters:
+  ///   - label: A human-readable label for the new instance. For more
+  ///     information, see ``init(rawValue:label:)``.
+  init<K, V>(label: String? = nil) where T == Dictionary<K, V> {
+    self.init(rawValue: [:], label: label)
   }
 }
@@ -0,0 +1,476 @@
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for Swift project authors
+//
+
+/// A type that computes a stable 128-bit hash of a sequence of bytes.
+///
+/// This type implements the 128-bit variant of the [FNV-1a](http://www.isthe.com/chongo/tech/comp/fnv/)
+/// hash function. Unlike `Hasher`, its output does not vary between processes,
+/// so it can be used to form identifiers that are stable across test runs. It
+/// is not suitable for cryptographic use.
+///
+/// This type is not part of the public interface of the testing library.
+struct StableHasher: Sendable {
+  /// The high 64 bits of the hash state, initially the high 64 bits of the
+  /// 128-bit FNV offset basis.
+  private var _high: UInt64 = 0x6C62_272E_07BB_0142
+
+  /// The low 64 bits of the hash state, initially the low 64 bits of the
+  /// 128-bit FNV offset basis.
+  private var _low: UInt64 = 0x62B8_2175_6295_C58D
+
+  init() {}
+
+  /// Feed a byte into this hasher.
+  ///
+  /// - Parameters:
+  ///   - byte: The byte to feed into this hasher.
+  mutating func combine(_ byte: UInt8) {
+    _low ^= UInt64(byte)
+
+    // Multiply the state by the 128-bit FNV prime, 2^88 + 0x13B, modulo 2^128.
+    // The 2^88 term only affects the high 64 bits of the product.
+    let (carry, low) = _low.multipliedFullWidth(by: 0x13B)
+    _high = (_high &* 0x13B) &+ carry &+ (_low << 24)
+    _low = low
+  }
+
+  /// Feed a sequence of bytes into this hasher.
+  ///
+  /// - Parameters:
+  ///   - bytes: The bytes to feed into this hasher.
+  mutating func combine(contentsOf bytes: some Sequence<UInt8>) {
+    for byte in bytes {
+      combine(byte)
+    }
+  }
+
+  /// Feed an integer into this hasher.
+  ///
+  /// - Parameters:
+  ///   - value: The integer to feed into this hasher. Its bytes are fed in
+  ///     little-endian order regardless of the byte order of the current
+  ///     platform.
+  mutating func combine(_ value: some FixedWidthInteger) {
+    withUnsafeBytes(of: value.littleEndian) { bytes in
+      combine(contentsOf: bytes)
+    }
+  }
+
+  /// The bytes of the hash value computed so far, in big-endian order.
+  var bytes: [UInt8] {
+    var result = [UInt8]()
+    result.reserveCapacity(16)
+    withUnsafeBytes(of: _high.bigEndian) { result += $0 }
+    withUnsafeBytes(of: _low.bigEndian) { result += $0 }
+    return result
+  }
+}
+
+// MARK: - Encoding
+
+/// A type that computes a stable hash of an encodable value without first
+/// encoding it in another format such as JSON.
+///
+/// The hash computed by this type depends only on the structure and contents
+/// of the encoded value. Like the JSON encoding used elsewhere in the testing
+/// library, the order in which keyed values are encoded does not affect the
+/// result (keys are effectively sorted), so values such as dictionaries produce
+/// the same hash in every process.
+///
+/// This type is not part of the public interface of the testing library.
+enum StableHashingEncoder {
+  /// Compute the stable hash of a value.
+  ///
+  /// - Parameters:
+  ///   - value: The value to hash.
+  ///   - userInfo: Any user info to pass into the encoder during encoding.
+  ///
+  /// - Returns: The 16 bytes of the resulting hash.
+  ///
+  /// - Throws: Any error thrown by `value` while encoding itself.
+  static func hash(of value: some Encodable, userInfo: [CodingUserInfoKey: Any] = [:]) throws -> [UInt8] {
+    let node = _Node()
+    try value.encode(to: _Encoder(node: node, codingPath: [], userInfo: userInfo))
+
+    var hasher = StableHasher()
+    node.hash(into: &hasher)
+    return hasher.bytes
+  }
+}
+
+/// A node in the tree of values built while encoding a value.
+///
+/// Keyed values must be hashed in a canonical order, but an `Encoder` has no
+/// way to know when a container is complete. Encoding therefore builds a tree
+/// of nodes, which is hashed once encoding is finished.
+private final class _Node {
+  /// The hasher for the single value stored in this node, if any.
+  var singleValue: StableHasher?
+
+  /// The elements of the unkeyed container stored in this node, if any.
+  var elements: [_Node]?
+
+  /// The entries of the keyed container stored in this node, if any.
+  var entries: [String: _Node]?
+
+  /// Feed the contents of this node into a hasher.
+  ///
+  /// - Parameters:
+  ///   - hasher: The hasher to feed this node's contents into.
+  func hash(into hasher: inout StableHasher) {
+    if let entries {
+      hasher.combine(UInt8(ascii: "K"))
+      hasher.combine(UInt64(entries.count))
+      for (key, node) in entries.sorted(by: { $0.key < $1.key }) {
+        let key = key.utf8
+        hasher.combine(UInt64(key.count))
+        hasher.combine(contentsOf: key)
+        node.hash(into: &hasher)
+      }
+    } else if let elements {
+      hasher.combine(UInt8(ascii: "U"))
+      hasher.combine(UInt64(elements.count))
+      for node in elements {
+        node.hash(into: &hasher)
+      }
+    } else if let singleValue {
+      hasher.combine(UInt8(ascii: "S"))
+      hasher.combine(contentsOf: singleValue.bytes)
+    } else {
+      hasher.combine(UInt8(ascii: "E"))
+    }
+  }
+}
+
+/// A protocol describing scalar values that the stable hashing encoder hashes
+/// directly.
+private protocol _StableHashingScalar {
+  /// Feed this value, prefixed with a tag identifying its kind, into a hasher.
+  ///
+  /// - Parameters:
+  ///   - hasher: The hasher to feed this value into.
+  func hash(into hasher: inout StableHasher)
+}
+
+extension Bool: _StableHashingScalar {
+  fileprivate func hash(into hasher: inout StableHasher) {
+    hasher.combine(UInt8(ascii: "b"))
+    hasher.combine(self ? 1 as UInt8 : 0)
+  }
+}
+
+extension String: _StableHashingScalar {
+  fileprivate func hash(into hasher: inout StableHasher) {
+    hasher.combine(UInt8(ascii: "s"))
+    hasher.combine(UInt64(utf8.count))
+    hasher.combine(contentsOf: utf8)
+  }
+}
+
+extension Double: _StableHashingScalar {
+  fileprivate func hash(into hasher: inout StableHasher) {
+    hasher.combine(UInt8(ascii: "d"))
+    hasher.combine(bitPattern)
+  }
+}
+
+extension Float: _StableHashingScalar {
+  fileprivate func hash(into hasher: inout StableHasher) {
+    hasher.combine(UInt8(ascii: "f"))
+    hasher.combine(bitPattern)
+  }
+}
+
+extension _StableHashingScalar where Self: FixedWidthInteger & SignedInteger {
+  fileprivate func hash(into hasher: inout StableHasher) {
+    // Hash all signed integers as 64-bit values so that, as with JSON, the
+    // result does not depend on the exact integer type used.
+    hasher.combine(UInt8(ascii: "i"))
+    hasher.combine(Int64(self))
+  }
+}
+
+extension _StableHashingScalar where Self: FixedWidthInteger & UnsignedInteger {
+  fileprivate func hash(into hasher: inout StableHasher) {
+    hasher.combine(UInt8(ascii: "u"))
+    hasher.combine(UInt64(self))
+  }
+}
+
+extension Int: _StableHashingScalar {}
+extension Int8: _StableHashingScalar {}
+extension Int16: _StableHashingScalar {}
+extension Int32: _StableHashingScalar {}
+extension Int64: _StableHashingScalar {}
+extension UInt: _StableHashingScalar {}
+extension UInt8: _StableHashingScalar {}
+extension UInt16: _StableHashingScalar {}
+extension UInt32: _StableHashingScalar {}
+extension UInt64: _StableHashingScalar {}
+
+/// The encoder used by ``StableHashingEncoder``.
+private struct _Encoder: Encoder {
+  /// The node this encoder writes to.
+  var node: _Node
+
+  var codingPath: [any CodingKey]
+
+  var userInfo: [CodingUserInfoKey: Any]
+
+  func container<Key>(keyedBy type: Key.Type) -> KeyedEncodingContainer<Key> where Key: CodingKey {
+    if node.entries == nil {
+      node.entries = [:]
+    }
+    return KeyedEncodingContainer(_KeyedContainer(node: node, codingPath: codingPath, userInfo: userInfo))
+  }
+
+  func unkeyedContainer() -> any UnkeyedEncodingContainer {
+    if node.elements == nil {
+      node.elements = []
+    }
+    return _UnkeyedContainer(node: node, codingPath: codingPath, userInfo: userInfo)
+  }
+
+  func singleValueContainer() -> any SingleValueEncodingContainer {
+    _SingleValueContainer(node: node, codingPath: codingPath, userInfo: userInfo)
+  }
+}
+
+/// The single-value encoding container used by ``StableHashingEncoder``.
+private struct _SingleValueContainer: SingleValueEncodingContainer {
+  /// The node this container writes to.
+  var node: _Node
+
+  var codingPath: [any CodingKey]
+
+  /// The user info of the encoder that created this container.
+  var userInfo: [CodingUserInfoKey: Any]
+
+  /// Store a scalar value in this container's node.
+  ///
+  /// - Parameters:
+  ///   - value: The value to store.
+  private func _encode(_ value: some _StableHashingScalar) {
+    var hasher = StableHasher()
+    value.hash(into: &hasher)
+    node.singleValue = hasher
+  }
+
+  mutating func encodeNil() throws {
+    var hasher = StableHasher()
+    hasher.combine(UInt8(ascii: "n"))
+    node.singleValue = hasher
+  }
+
+  mutating func encode(_ value: Bool) throws { _encode(value) }
+  mutating func encode(_ value: String) throws { _encode(value) }
+  mutating func encode(_ value: Double) throws { _encode(value) }
+  mutating func encode(_ value: Float) throws { _encode(value) }
+  mutating func encode(_ value: Int) throws { _encode(value) }
+  mutating func encode(_ value: Int8) throws { _encode(value) }
+  mutating func encode(_ value: Int16) throws { _encode(value) }
+  mutating func encode(_ value: Int32) throws { _encode(value) }
+  mutating func encode(_ value: Int64) throws { _encode(value) }
+  mutating func encode(_ value: UInt) throws { _encode(value) }
+  mutating func encode(_ value: UInt8) throws { _encode(value) }
+  mutating func encode(_ value: UInt16) throws { _encode(value) }
+  mutating func encode(_ value: UInt32) throws { _encode(value) }
+  mutating func encode(_ value: UInt64) throws { _encode(value) }
+
+  mutating func encode<T>(_ value: T) throws where T: Encodable {
+    try value.encode(to: _Encoder(node: node, codingPath: codingPath, userInfo: userInfo))
+  }
+}
+
+/// The keyed encoding container used by ``StableHashingEncoder``.
+private struct _KeyedContainer<Key>: KeyedEncodingContainerProtocol where Key: CodingKey {
+  /// The node this container writes to.
+  var node: _Node
+
+  var codingPath: [any CodingKey]
+
+  /// The user info of the encoder that created this container.
+  var userInfo: [CodingUserInfoKey: Any]
+
+  /// Get an encoder for the value stored for a given key, replacing any
+  /// value previously stored for it.
+  ///
+  /// - Parameters:
+  ///   - key: The key of the value to encode.
+  ///
+  /// - Returns: An encoder that writes to a new node stored for `key`.
+  private func _encoder(forKey key: some CodingKey) -> _Encoder {
+    let child = _Node()
+    node.entries![key.stringValue] = child
+    var codingPath = codingPath
+    codingPath.append(key)
+    return _Encoder(node: child, codingPath: codingPath, userInfo: userInfo)
+  }
+
+  /// Encode a value for a given key.
+  ///
+  /// - Parameters:
+  ///   - value: The value to encode.
+  ///   - key: The key to associate with `value`.
+  private func _encode(_ value: some Encodable, forKey key: Key) throws {
+    var container = _encoder(forKey: key).singleValueContainer()
+    try container.encode(value)
+  }
+
+  mutating func encodeNil(forKey key: Key) throws {
+    var container = _encoder(forKey: key).singleValueContainer()
+    try container.encodeNil()
+  }
+
+  mutating func encode(_ value: Bool, forKey key: Key) throws { try _encode(value, forKey: key) }
+  mutating func encode(_ value: String, forKey key: Key) throws { try _encode(value, forKey: key) }
+  mutating func encode(_ value: Double, forKey key: Key) throws { try _encode(value, forKey: key) }
+  mutating func encode(_ value: Float, forKey key: Key) throws { try _encode(value, forKey: key) }
+  mutating func encode(_ value: Int, forKey key: Key) throws { try _encode(value, forKey: key) }
+  mutating func encode(_ value: Int8, forKey key: Key) throws { try _encode(value, forKey: key) }
+  mutating func encode(_ value: Int16, forKey key: Key) throws { try _encode(value, forKey: key) }
+  mutating func encode(_ value: Int32, forKey key: Key) throws { try _encode(value, forKey: key) }
+  mutating func encode(_ value: Int64, forKey key: Key) throws { try _encode(value, forKey: key) }
+  mutating func encode(_ value: UInt, forKey key: Key) throws { try _encode(value, forKey: key) }
+  mutating func encode(_ value: UInt8, forKey key: Key) throws { try _encode(value, forKey: key) }
+  mutating func encode(_ value: UInt16, forKey key: Key) throws { try _encode(value, forKey: key) }
+  mutating func encode(_ value: UInt32, forKey key: Key) throws { try _encode(value, forKey: key) }
+  mutating func encode(_ value: UInt64, forKey key: Key) throws { try _encode(value, forKey: key) }
+
+  mutating func encode<T>(_ value: T, forKey key: Key) throws where T: Encodable {
+    try _encode(value, forKey: key)
+  }
+
+  mutating func nestedContainer<NestedKey>(keyedBy keyType: NestedKey.Type, forKey key: Key) -> KeyedEncodingContainer<NestedKey> where NestedKey: CodingKey {
+    _encoder(forKey: key).container(keyedBy: keyType)
+  }
+
+  mutating func nestedUnkeyedContainer(forKey key: Key) -> any UnkeyedEncodingContainer {
+    _encoder(forKey: key).unkeyedContainer()
+  }
+
+  mutating func superEncoder() -> any Encoder {
+    _encoder(forKey: _SuperKey())
+  }
+
+  mutating func superEncoder(forKey key: Key) -> any Encoder {
+    _encoder(forKey: key)
+  }
+}
+
+/// The unkeyed encoding container used by ``StableHashingEncoder``.
+private struct _UnkeyedContainer: UnkeyedEncodingContainer {
+  /// The node this container writes to.
+  var node: _Node
+
+  var codingPath: [any CodingKey]
+
+  /// The user info of the encoder that created this container.
+  var userInfo: [CodingUserInfoKey: Any]
+
+  var count: Int {
+    node.elements!.count
+  }
+
+  /// Get an encoder for a new element appended to this container.
+  ///
+  /// - Returns: An encoder that writes to a new node appended to this
+  ///   container.
+  private func _encoderForNextElement() -> _Encoder {
+    let child = _Node()
+    var codingPath = codingPath
+    codingPath.append(_IndexKey(intValue: count))
+    node.elements!.append(child)
+    return _Encoder(node: child, codingPath: codingPath, userInfo: userInfo)
+  }
+
+  /// Append a value to this container.
+  ///
+  /// - Parameters:
+  ///   - value: The value to encode.
+  private func _encode(_ value: some Encodable) throws {
+    var container = _encoderForNextElement().singleValueContainer()
+    try container.encode(value)
+  }
+
+  mutating func encodeNil() throws {
+    var container = _encoderForNextElement().singleValueContainer()
+    try container.encodeNil()
+  }
+
+  mutating func encode(_ value: Bool) throws { try _encode(value) }
+  mutating func encode(_ value: String) throws { try _encode(value) }
+  mutating func encode(_ value: Double) throws { try _encode(value) }
+  mutating func encode(_ value: Float) throws { try _encode(value) }
+  mutating func encode(_ value: Int) throws { try _encode(value) }
+  mutating func encode(_ value: Int8) throws { try _encode(value) }
+  mutating func encode(_ value: Int16) throws { try _encode(value) }
+  mutating func encode(_ value: Int32) throws { try _encode(value) }
+  mutating func encode(_ value: Int64) throws { try _encode(value) }
+  mutating func encode(_ value: UInt) throws { try _encode(value) }
+  mutating func encode(_ value: UInt8) throws { try _encode(value) }
+  mutating func encode(_ value: UInt16) throws { try _encode(value) }
+  mutating func encode(_ value: UInt32) throws { try _encode(value) }
+  mutating func encode(_ value: UInt64) throws { try _encode(value) }
+
+  mutating func encode<T>(_ value: T) throws where T: Encodable {
+    try _encode(value)
+  }
+
+  mutating func nestedContainer<NestedKey>(keyedBy keyType: NestedKey.Type) -> KeyedEncodingContainer<NestedKey> where NestedKey: CodingKey {
+    _encoderForNextElement().container(keyedBy: keyType)
+  }
+
+  mutating func nestedUnkeyedContainer() -> any UnkeyedEncodingContainer {
+    _encoderForNextElement().unkeyedContainer()
+  }
+
+  mutating func superEncoder() -> any Encoder {
+    _encoderForNextElement()
+  }
+}
+
+/// The coding key used for the elements of an unkeyed container.
+private struct _IndexKey: CodingKey {
+  var intValue: Int?
+
+  var stringValue: String {
+    String(intValue!)
+  }
+
+  init(intValue: Int) {
+    self.intValue = intValue
+  }
+
+  init?(stringValue: String) {
+    return nil
+  }
+}
+
+/// The coding key used by ``_KeyedContainer/superEncoder()``.
+private struct _SuperKey: CodingKey {
+  var stringValue: String {
+    "super"
+  }
+
+  var intValue: Int? {
+    nil
+  }
+
+  init() {}
+
+  init?(stringValue: String) {
+    return nil
+  }
+
+  init?(intValue: Int) {
+    return nil
+  }
+}
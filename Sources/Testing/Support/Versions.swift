@@ -139,6 +139,24 @@ var targetTriple: String? {
   swt_getTargetTriple().flatMap(String.init(validatingCString:))
 }
 
+/// The number of processors available to the current process.
+///
+/// The value of this property is always at least `1`.
+///
+/// This value is not part of the public interface of the testing library.
+let activeProcessorCount: Int = {
+#if SWT_TARGET_OS_APPLE || os(Linux) || os(FreeBSD) || os(Android)
+  let processorCount = Int(sysconf(CInt(_SC_NPROCESSORS_ONLN)))
+#elseif os(Windows)
+  var systemInfo = SYSTEM_INFO()
+  GetSystemInfo(&systemInfo)
+  let processorCount = Int(systemInfo.dwNumberOfProcessors)
+#else
+  let processorCount = 1
+#endif
+  return max(1, processorCount)
+}()
+
 /// A human-readable string describing the Swift Standard Library's version.
 ///
 /// This value's format is platform-specific and is not meant to be
@@ -0,0 +1,143 @@
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for Swift project authors
+//
+
+/// A type that limits the heap allocations a test may make.
+///
+/// When this trait is applied to a test function, the heap allocations made
+/// by each of its test cases are tracked. If a test case exceeds the budget, an
+/// issue of kind
+/// ``Issue/Kind-swift.enum/allocationBudgetExceeded(_:budget:)`` is recorded.
+///
+/// Only the allocations made by the thread a test case starts on are tracked,
+/// so the budget is best suited to test functions that do not suspend.
+/// Allocation tracking is only available if the testing library was built
+/// with `SWT_ENABLE_ALLOCATION_TRACKING` defined. If it is not available, or
+/// if a test case resumes on a different thread after suspending, the budget
+/// cannot be checked and a known issue is recorded instead, so that the test
+/// case does not fail but is not reported as having passed cleanly either.
+///
+/// Because allocations are tracked per thread, the test cases of a test with
+/// an allocation budget run in isolation from all other test cases, even when
+/// parallelization is enabled. Other test cases therefore cannot run on the
+/// tracked thread and be counted against the budget.
+///
+/// To add this trait to a test, use
+/// ``Trait/allocationBudget(allocations:bytes:)``.
+@_spi(Experimental)
+public struct AllocationBudgetTrait: TestTrait, Codable {
+  /// The maximum number of heap allocations each test case may make, if
+  /// limited.
+  public var maximumAllocationCount: Int?
+
+  /// The maximum total size, in bytes, of the heap allocations each test case
+  /// may make, if limited.
+  public var maximumByteCount: Int?
+}
+
+// MARK: -
+
+@_spi(Experimental)
+extension Trait where Self == AllocationBudgetTrait {
+  /// Construct a trait that limits the heap allocations a test may make.
+  ///
+  /// - Parameters:
+  ///   - allocations: The maximum number of heap allocations each test case
+  ///     may make, or `nil` to not limit the number of allocations.
+  ///   - bytes: The maximum total size, in bytes, of the heap allocations each
+  ///     test case may make, or `nil` to not limit their size.
+  ///
+  /// - Returns: An instance of ``AllocationBudgetTrait``.
+  ///
+  /// Only allocations made while the body of a test case runs count toward
+  /// the budget. Allocations made by the testing library itself (for
+  /// instance, while recording an issue) may also be counted.
+  public static func allocationBudget(allocations: Int? = nil, bytes: Int? = nil) -> Self {
+    precondition(allocations.map { $0 >= 0 } ?? true, "An allocation budget cannot allow a negative number of allocations.")
+    precondition(bytes.map { $0 >= 0 } ?? true, "An allocation budget cannot allow a negative number of bytes.")
+    return Self(maximumAllocationCount: allocations, maximumByteCount: bytes)
+  }
+}
+
+extension Test {
+  /// The allocation budget of this test, if any.
+  var allocationBudget: AllocationBudgetTrait? {
+    traits.lazy
+      .compactMap { $0 as? AllocationBudgetTrait }
+      .first
+  }
+}
+
+// MARK: - Checking allocations
+
+extension AllocationBudgetTrait {
+  /// Whether or not some allocations exceed this budget.
+  ///
+  /// - Parameters:
+  ///   - allocationCounts: The allocations to check.
+  ///
+  /// - Returns: Whether or not `allocationCounts` exceeds this budget.
+  func isExceeded(by allocationCounts: Event.AllocationCounts) -> Bool {
+    if let maximumAllocationCount, allocationCounts.allocationCount > maximumAllocationCount {
+      return true
+    }
+    if let maximumByteCount, allocationCounts.allocatedByteCount > maximumByteCount {
+      return true
+    }
+    return false
+  }
+
+  /// Check some allocations against this budget and record an issue if they
+  /// exceed it.
+  ///
+  /// - Parameters:
+  ///   - allocationCounts: The allocations to check.
+  ///   - test: The test that made the allocations.
+  func check(_ allocationCounts: Event.AllocationCounts, for test: Test) {
+    guard isExceeded(by: allocationCounts) else {
+      return
+    }
+    let issue = Issue(
+      kind: .allocationBudgetExceeded(allocationCounts, budget: self),
+      comments: [],
+      sourceContext: .init(backtrace: nil, sourceLocation: test.sourceLocation)
+    )
+    issue.record()
+  }
+
+  /// Record a known issue noting that this budget could not be checked.
+  ///
+  /// - Parameters:
+  ///   - reason: Why the budget could not be checked.
+  ///   - test: The test that this budget applies to.
+  ///
+  /// The issue is recorded as a known issue so that a test case whose budget
+  /// cannot be checked neither fails nor silently passes.
+  func recordUnchecked(because reason: String, for test: Test) {
+    var issue = Issue(
+      kind: .unconditional,
+      comments: [Comment(rawValue: "The allocation budget was not checked because \(reason).")],
+      sourceContext: .init(backtrace: nil, sourceLocation: test.sourceLocation)
+    )
+    issue.isKnown = true
+    issue.record()
+  }
+
+  /// A human-readable description of this budget.
+  var summary: String {
+    var limits = [String]()
+    if let maximumAllocationCount {
+      limits.append(maximumAllocationCount.counting("allocation"))
+    }
+    if let maximumByteCount {
+      limits.append(maximumByteCount.counting("byte"))
+    }
+    return limits.isEmpty ? "unlimited" : "at most \(limits.joined(separator: " and "))"
+  }
+}
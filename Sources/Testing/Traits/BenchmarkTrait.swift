@@ -0,0 +1,289 @@
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for Swift project authors
+//
+
+private import _TestingInternals
+
+/// A type that causes a test to be run repeatedly as a benchmark.
+///
+/// When this trait is applied to a test function, each of its test cases is
+/// run several times to warm up, then run repeatedly while the duration of
+/// each iteration is measured with ``Test/Clock``. Summary statistics about
+/// those durations are then posted as an event of kind
+/// ``Event/Kind-swift.enum/benchmarkEnded(_:)``, which appears in the console
+/// output and in the event stream. If an iteration fails, the test case stops
+/// being benchmarked and no statistics are posted for it.
+///
+/// To add this trait to a test, use
+/// ``Trait/benchmark(iterations:warmup:isolated:)``.
+@_spi(Experimental)
+public struct BenchmarkTrait: TestTrait {
+  /// The number of measured iterations to run each test case for, or `nil` if
+  /// the number should be calibrated based on the duration of the first
+  /// warmup iteration.
+  public var iterationCount: Int?
+
+  /// The number of unmeasured iterations to run each test case for before
+  /// measuring it.
+  public var warmupIterationCount: Int
+
+  /// Whether or not test cases benchmarked with this trait run in isolation
+  /// from all other test cases in the same test run.
+  ///
+  /// When the value of this property is `true`, the testing library waits for
+  /// other test cases to finish before running a benchmarked test case, and
+  /// does not start any other test cases until it finishes.
+  public var isIsolated: Bool
+
+  /// The total amount of time, in nanoseconds, that calibrated benchmarks aim
+  /// to spend in measured iterations of each test case.
+  private static var _calibrationTargetNanoseconds: Int64 {
+    1_000_000_000
+  }
+
+  /// The range of iteration counts that calibration may select.
+  private static var _calibratedIterationCountRange: ClosedRange<Int64> {
+    10 ... 100_000
+  }
+}
+
+// MARK: - Statistics
+
+extension BenchmarkTrait {
+  /// A type describing the durations measured while benchmarking a test case.
+  ///
+  /// All durations are measured in nanoseconds using ``Test/Clock``.
+  public struct Statistics: Sendable, Codable {
+    /// The number of measured iterations.
+    public var iterationCount: Int
+
+    /// The duration of the fastest iteration.
+    public var minimumNanoseconds: Int64
+
+    /// The median duration of all iterations.
+    public var medianNanoseconds: Int64
+
+    /// The 99th-percentile duration of all iterations.
+    public var p99Nanoseconds: Int64
+
+    /// The duration of the slowest iteration.
+    public var maximumNanoseconds: Int64
+
+    /// The mean duration of all iterations.
+    public var meanNanoseconds: Double
+
+    /// The sample standard deviation of the durations of all iterations.
+    public var standardDeviationNanoseconds: Double
+
+    /// Initialize an instance of this type by summarizing a sequence of
+    /// measured durations.
+    ///
+    /// - Parameters:
+    ///   - durations: The measured duration of each iteration, in nanoseconds.
+    ///     This array must not be empty.
+    init(durations: [Int64]) {
+      precondition(!durations.isEmpty, "Cannot compute statistics for an empty benchmark.")
+      let durations = durations.sorted()
+      let count = durations.count
+
+      iterationCount = count
+      minimumNanoseconds = durations[0]
+      maximumNanoseconds = durations[count - 1]
+      medianNanoseconds = if count % 2 == 1 {
+        durations[count / 2]
+      } else {
+        (durations[count / 2 - 1] + durations[count / 2]) / 2
+      }
+
+      // Use the nearest-rank method so that the result is always one of the
+      // measured durations.
+      let p99Rank = (count * 99 + 99) / 100
+      p99Nanoseconds = durations[min(max(p99Rank, 1), count) - 1]
+
+      let mean = durations.reduce(0.0) { $0 + Double($1) } / Double(count)
+      meanNanoseconds = mean
+      if count > 1 {
+        let sumOfSquares = durations.reduce(0.0) { sumOfSquares, duration in
+          let difference = Double(duration) - mean
+          return sumOfSquares + difference * difference
+        }
+        standardDeviationNanoseconds = (sumOfSquares / Double(count - 1)).squareRoot()
+      } else {
+        standardDeviationNanoseconds = 0
+      }
+    }
+  }
+}
+
+// MARK: - CustomExecutionTrait
+
+@_spi(Experimental)
+extension BenchmarkTrait: CustomExecutionTrait {
+  public func execute(_ function: @Sendable () async throws -> Void, for test: Test, testCase: Test.Case?) async throws {
+    guard let testCase else {
+      // This trait is invoked once for the test as a whole (wrapping all of
+      // its test cases) and then once per test case. Only the latter are
+      // benchmarked.
+      return try await function()
+    }
+
+    var measuredIterationCount = iterationCount.map(Int64.init)
+    for _ in 0 ..< warmupIterationCount {
+      let startInstant = Test.Clock.Instant.now
+      guard try await Self._runIteration(function) else {
+        return
+      }
+      if measuredIterationCount == nil {
+        measuredIterationCount = Self._calibratedIterationCount(forNanoseconds: startInstant.nanoseconds(until: .now))
+      }
+    }
+    if measuredIterationCount == nil {
+      // There were no warmup iterations to calibrate with, so an additional
+      // unmeasured iteration is run instead.
+      let startInstant = Test.Clock.Instant.now
+      guard try await Self._runIteration(function) else {
+        return
+      }
+      measuredIterationCount = Self._calibratedIterationCount(forNanoseconds: startInstant.nanoseconds(until: .now))
+    }
+
+    let measuredIterationCountValue = Int(measuredIterationCount ?? 1)
+    var durations = [Int64]()
+    durations.reserveCapacity(measuredIterationCountValue)
+    for _ in 0 ..< measuredIterationCountValue {
+      try Task.checkCancellation()
+      let startInstant = Test.Clock.Instant.now
+      guard try await Self._runIteration(function) else {
+        return
+      }
+      durations.append(startInstant.nanoseconds(until: .now))
+    }
+
+    Event.post(.benchmarkEnded(Statistics(durations: durations)), for: (test, testCase))
+  }
+
+  /// Run a single iteration of a benchmark.
+  ///
+  /// - Parameters:
+  ///   - function: The function to call.
+  ///
+  /// - Returns: Whether or not the iteration passed. If it recorded an unknown
+  ///   issue, it failed and benchmarking should stop.
+  ///
+  /// - Throws: Whatever is thrown by `function`.
+  ///
+  /// A failing iteration stops the benchmark so that a test with a failing
+  /// expectation records its issues once rather than once per iteration, and
+  /// so that the measurements of a failing test are not reported.
+  private static func _runIteration(_ function: @Sendable () async throws -> Void) async throws -> Bool {
+    try await !Issue.recordingUnknownIssues(during: function)
+  }
+
+  /// Choose the number of iterations for a benchmark.
+  ///
+  /// - Parameters:
+  ///   - nanoseconds: The duration of a single iteration of the benchmark.
+  ///
+  /// - Returns: The number of iterations that should take approximately
+  ///   ``_calibrationTargetNanoseconds`` to run, clamped to
+  ///   ``_calibratedIterationCountRange``.
+  private static func _calibratedIterationCount(forNanoseconds nanoseconds: Int64) -> Int64 {
+    let iterationCount = _calibrationTargetNanoseconds / max(1, nanoseconds)
+    return min(max(iterationCount, _calibratedIterationCountRange.lowerBound), _calibratedIterationCountRange.upperBound)
+  }
+}
+
+// MARK: -
+
+@_spi(Experimental)
+extension Trait where Self == BenchmarkTrait {
+  /// Construct a trait that causes a test to be run repeatedly as a benchmark.
+  ///
+  /// - Parameters:
+  ///   - iterations: The number of measured iterations to run each test case
+  ///     for. If `nil`, the testing library chooses a number of iterations
+  ///     based on how long the first iteration takes to run, aiming for about
+  ///     one second of measurements per test case.
+  ///   - warmup: The number of unmeasured iterations to run each test case for
+  ///     before measuring it.
+  ///   - isolated: Whether or not to run each benchmarked test case in
+  ///     isolation from all other test cases in the same test run. Isolating a
+  ///     benchmark reduces the noise in its measurements at the cost of
+  ///     reducing parallelism in the test run.
+  ///
+  /// - Returns: An instance of ``BenchmarkTrait``.
+  ///
+  /// If an iteration of a test case records an issue or throws an error,
+  /// benchmarking of that test case stops after that iteration and no
+  /// statistics are reported for it.
+  public static func benchmark(iterations: Int? = nil, warmup: Int = 1, isolated: Bool = true) -> Self {
+    precondition(iterations.map { $0 > 0 } ?? true, "A benchmark must run for at least one iteration.")
+    precondition(warmup >= 0, "A benchmark cannot run for a negative number of warmup iterations.")
+    return Self(iterationCount: iterations, warmupIterationCount: warmup, isIsolated: isolated)
+  }
+}
+
+extension Test {
+  /// Whether or not this test's cases must run in isolation from all other
+  /// test cases in the same test run.
+  ///
+  /// A test's cases run in isolation if it is an isolated benchmark or if it
+  /// has an allocation budget. Allocations are tracked per thread, so another
+  /// test case running on the same thread while one with a budget is
+  /// suspended would otherwise have its allocations counted against that
+  /// budget.
+  var isIsolated: Bool {
+    if allocationBudget != nil {
+      return true
+    }
+    return traits.lazy
+      .compactMap { $0 as? BenchmarkTrait }
+      .contains(where: \.isIsolated)
+  }
+}
+
+// MARK: - Formatting
+
+extension BenchmarkTrait.Statistics {
+  /// Get a human-readable description of a number of nanoseconds.
+  ///
+  /// - Parameters:
+  ///   - nanoseconds: The number of nanoseconds to describe.
+  ///
+  /// - Returns: A string describing `nanoseconds` in the largest unit that
+  ///   keeps its value at or above `1`, with three decimal places.
+  static func descriptionOfNanoseconds(_ nanoseconds: Double) -> String {
+    let (value, unit): (Double, String) = switch nanoseconds {
+    case ..<1_000:
+      (nanoseconds, "ns")
+    case ..<1_000_000:
+      (nanoseconds / 1_000, "µs")
+    case ..<1_000_000_000:
+      (nanoseconds / 1_000_000, "ms")
+    default:
+      (nanoseconds / 1_000_000_000, "s")
+    }
+
+    return withUnsafeTemporaryAllocation(of: CChar.self, capacity: 64) { buffer in
+      withVaList([value]) { args in
+        _ = vsnprintf(buffer.baseAddress!, buffer.count, "%.3f", args)
+      }
+      return "\(String(cString: buffer.baseAddress!)) \(unit)"
+    }
+  }
+
+  /// A human-readable summary of these statistics.
+  var summary: String {
+    let minimum = Self.descriptionOfNanoseconds(Double(minimumNanoseconds))
+    let median = Self.descriptionOfNanoseconds(Double(medianNanoseconds))
+    let p99 = Self.descriptionOfNanoseconds(Double(p99Nanoseconds))
+    let standardDeviation = Self.descriptionOfNanoseconds(standardDeviationNanoseconds)
+    return "min \(minimum), median \(median), p99 \(p99), stddev \(standardDeviation) over \(iterationCount.counting("iteration"))"
+  }
+}
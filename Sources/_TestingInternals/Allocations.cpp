@@ -0,0 +1,265 @@
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for Swift project authors
+//
+
+#include "Allocations.h"
+
+#if defined(SWT_ENABLE_ALLOCATION_TRACKING) && defined(__GLIBC__)
+#include <atomic>
+#include <mutex>
+
+#include <malloc.h>
+
+namespace {
+/// A type describing the tracking session of a thread.
+struct Slot {
+  /// The tracker in use, if any.
+  struct Tracker *tracker;
+
+  /// The generation of `tracker` at the time the session started. If the
+  /// tracker's generation no longer matches, the session has ended.
+  uint64_t generation;
+};
+
+/// A type describing a tracking session.
+///
+/// Instances of this type are pooled and never deallocated, so a thread that
+/// still refers to a session after it ends (because the session ended on a
+/// different thread) can safely check its generation.
+struct Tracker {
+  /// The generation of this tracker, incremented each time a session using it
+  /// ends.
+  std::atomic<uint64_t> generation;
+
+  /// The counts for the current session.
+  std::atomic<uint64_t> allocationCount;
+  std::atomic<uint64_t> deallocationCount;
+  std::atomic<uint64_t> allocatedByteCount;
+  std::atomic<uint64_t> deallocatedByteCount;
+
+  /// The session that was active on the thread that started this session.
+  Slot previousSlot;
+
+  /// The next tracker in the pool of unused trackers.
+  Tracker *nextUnused;
+};
+
+/// The tracking session of the current thread.
+///
+/// This variable is trivially initialized and uses the initial-exec TLS model
+/// so that accessing it never allocates memory (which would otherwise recurse
+/// into the functions below.)
+constinit thread_local Slot currentSlot __attribute__((tls_model("initial-exec"))) {};
+
+/// The pool of trackers not currently in use.
+std::mutex unusedTrackersLock;
+Tracker *unusedTrackers = nullptr;
+
+/// Get the tracker that should count an allocation or deallocation made by the
+/// current thread.
+///
+/// - Returns: The tracker of the current thread's active session, or `nullptr`
+///   if the current thread is not tracking allocations.
+Tracker *activeTracker(void) {
+  Slot slot = currentSlot;
+  if (slot.tracker && slot.tracker->generation.load(std::memory_order_relaxed) == slot.generation) {
+    return slot.tracker;
+  }
+  return nullptr;
+}
+
+/// Count an allocation.
+///
+/// - Parameters:
+///   - ptr: The newly-allocated block, or `nullptr` if allocation failed.
+void countAllocation(void *ptr) {
+  if (ptr) {
+    if (Tracker *tracker = activeTracker()) {
+      tracker->allocationCount.fetch_add(1, std::memory_order_relaxed);
+      tracker->allocatedByteCount.fetch_add(malloc_usable_size(ptr), std::memory_order_relaxed);
+    }
+  }
+}
+
+/// Count a deallocation.
+///
+/// - Parameters:
+///   - ptr: The block about to be deallocated, or `nullptr`.
+void countDeallocation(void *ptr) {
+  if (ptr) {
+    if (Tracker *tracker = activeTracker()) {
+      tracker->deallocationCount.fetch_add(1, std::memory_order_relaxed);
+      tracker->deallocatedByteCount.fetch_add(malloc_usable_size(ptr), std::memory_order_relaxed);
+    }
+  }
+}
+}
+
+// MARK: - Interposed functions
+
+/// glibc's implementations of the allocation functions interposed below.
+///
+/// These functions are exported by glibc for use by replacement allocators.
+/// Calling them (rather than looking up the next definitions with `dlsym()`)
+/// avoids allocating memory while an allocation is already in progress.
+extern "C" {
+void *__libc_malloc(size_t size);
+void *__libc_calloc(size_t count, size_t size);
+void *__libc_realloc(void *ptr, size_t size);
+void *__libc_memalign(size_t alignment, size_t size);
+void *__libc_valloc(size_t size);
+void *__libc_pvalloc(size_t size);
+void __libc_free(void *ptr);
+}
+
+void *malloc(size_t size) noexcept {
+  void *result = __libc_malloc(size);
+  countAllocation(result);
+  return result;
+}
+
+void *calloc(size_t count, size_t size) noexcept {
+  void *result = __libc_calloc(count, size);
+  countAllocation(result);
+  return result;
+}
+
+void *realloc(void *ptr, size_t size) noexcept {
+  if (!ptr) {
+    return malloc(size);
+  }
+
+  // The old block's size must be read before it is potentially freed. If the
+  // reallocation fails, the old block is untouched and nothing is counted.
+  Tracker *tracker = activeTracker();
+  size_t oldSize = tracker ? malloc_usable_size(ptr) : 0;
+  void *result = __libc_realloc(ptr, size);
+  if (tracker && (result || size == 0)) {
+    tracker->deallocationCount.fetch_add(1, std::memory_order_relaxed);
+    tracker->deallocatedByteCount.fetch_add(oldSize, std::memory_order_relaxed);
+    countAllocation(result);
+  }
+  return result;
+}
+
+void free(void *ptr) noexcept {
+  countDeallocation(ptr);
+  __libc_free(ptr);
+}
+
+int posix_memalign(void **outPtr, size_t alignment, size_t size) noexcept {
+  if (alignment % sizeof(void *) != 0 || (alignment & (alignment - 1)) != 0) {
+    return EINVAL;
+  }
+  void *result = __libc_memalign(alignment, size);
+  if (!result) {
+    return ENOMEM;
+  }
+  countAllocation(result);
+  *outPtr = result;
+  return 0;
+}
+
+void *aligned_alloc(size_t alignment, size_t size) noexcept {
+  void *result = __libc_memalign(alignment, size);
+  countAllocation(result);
+  return result;
+}
+
+void *memalign(size_t alignment, size_t size) noexcept {
+  void *result = __libc_memalign(alignment, size);
+  countAllocation(result);
+  return result;
+}
+
+void *valloc(size_t size) noexcept {
+  void *result = __libc_valloc(size);
+  countAllocation(result);
+  return result;
+}
+
+void *pvalloc(size_t size) noexcept {
+  void *result = __libc_pvalloc(size);
+  countAllocation(result);
+  return result;
+}
+
+// MARK: - Tracking sessions
+
+bool swt_allocationTrackingIsAvailable(void) {
+  return true;
+}
+
+const void *swt_allocationTrackingBegin(void) {
+  Tracker *tracker = nullptr;
+  {
+    std::lock_guard lock(unusedTrackersLock);
+    tracker = unusedTrackers;
+    if (tracker) {
+      unusedTrackers = tracker->nextUnused;
+    }
+  }
+  if (!tracker) {
+    // The new tracker is deliberately never deallocated. See Tracker.
+    tracker = new Tracker {};
+  }
+
+  tracker->allocationCount.store(0, std::memory_order_relaxed);
+  tracker->deallocationCount.store(0, std::memory_order_relaxed);
+  tracker->allocatedByteCount.store(0, std::memory_order_relaxed);
+  tracker->deallocatedByteCount.store(0, std::memory_order_relaxed);
+
+  // Suspend any session already active on this thread.
+  tracker->previousSlot = currentSlot;
+  currentSlot = { tracker, tracker->generation.load(std::memory_order_acquire) };
+  return tracker;
+}
+
+bool swt_allocationTrackingEnd(const void *token, SWTAllocationCounts *outCounts) {
+  auto tracker = const_cast<Tracker *>(reinterpret_cast<const Tracker *>(token));
+
+  // Ending the generation stops any thread still referring to this session
+  // from counting further allocations.
+  uint64_t generation = tracker->generation.fetch_add(1, std::memory_order_acq_rel);
+  bool isSameThread = currentSlot.tracker == tracker && currentSlot.generation == generation;
+
+  *outCounts = {
+    tracker->allocationCount.load(std::memory_order_relaxed),
+    tracker->deallocationCount.load(std::memory_order_relaxed),
+    tracker->allocatedByteCount.load(std::memory_order_relaxed),
+    tracker->deallocatedByteCount.load(std::memory_order_relaxed),
+  };
+
+  if (isSameThread) {
+    currentSlot = tracker->previousSlot;
+  }
+
+  {
+    std::lock_guard lock(unusedTrackersLock);
+    tracker->nextUnused = unusedTrackers;
+    unusedTrackers = tracker;
+  }
+
+  return isSameThread;
+}
+#else
+bool swt_allocationTrackingIsAvailable(void) {
+  return false;
+}
+
+const void *swt_allocationTrackingBegin(void) {
+  return nullptr;
+}
+
+bool swt_allocationTrackingEnd(const void *token, SWTAllocationCounts *outCounts) {
+  (void)token;
+  *outCounts = {};
+  return false;
+}
+#endif
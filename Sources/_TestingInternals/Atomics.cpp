@@ -0,0 +1,32 @@
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for Swift project authors
+//
+
+#include "Atomics.h"
+
+#include <atomic>
+
+static_assert(std::atomic_ref<intptr_t>::is_always_lock_free,
+  "intptr_t must be lock-free on all supported targets");
+
+intptr_t swt_atomic_load(const intptr_t *address) {
+  return std::atomic_ref(*const_cast<intptr_t *>(address)).load();
+}
+
+void swt_atomic_store(intptr_t *address, intptr_t value) {
+  std::atomic_ref(*address).store(value);
+}
+
+intptr_t swt_atomic_fetch_add(intptr_t *address, intptr_t addend) {
+  return std::atomic_ref(*address).fetch_add(addend);
+}
+
+bool swt_atomic_compare_exchange(intptr_t *address, intptr_t *expected, intptr_t desired) {
+  return std::atomic_ref(*address).compare_exchange_strong(*expected, desired);
+}
@@ -0,0 +1,55 @@
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for Swift project authors
+//
+
+#include "Clock.h"
+
+#if defined(__APPLE__) || defined(__linux__) || defined(__ANDROID__)
+namespace {
+/// The clock read by ``swt_clock_suspendingNanoseconds()``.
+///
+/// This clock must match the one used by `SuspendingClock`.
+/// SEE: https://github.com/swiftlang/swift/blob/main/stdlib/public/Concurrency/Clock.cpp
+#if defined(__APPLE__)
+constexpr clockid_t suspendingClockID = CLOCK_UPTIME_RAW;
+#else
+constexpr clockid_t suspendingClockID = CLOCK_MONOTONIC;
+#endif
+
+/// Read a clock.
+///
+/// - Parameters:
+///   - clockID: The clock to read.
+///
+/// - Returns: The number of nanoseconds since the epoch of `clockID`.
+uint64_t nanoseconds(clockid_t clockID) {
+#if defined(__APPLE__)
+  return clock_gettime_nsec_np(clockID);
+#else
+  struct timespec ts {};
+  (void)clock_gettime(clockID, &ts);
+  return static_cast<uint64_t>(ts.tv_sec) * 1'000'000'000 + static_cast<uint64_t>(ts.tv_nsec);
+#endif
+}
+}
+
+uint64_t swt_clock_suspendingNanoseconds(void) {
+  return nanoseconds(suspendingClockID);
+}
+
+int64_t swt_clock_wallOffsetNanoseconds(void) {
+  // Read the suspending clock on both sides of the wall clock and use the
+  // midpoint so that the offset is not skewed by the time taken to read it.
+  uint64_t before = nanoseconds(suspendingClockID);
+  uint64_t wall = nanoseconds(CLOCK_REALTIME);
+  uint64_t after = nanoseconds(suspendingClockID);
+  uint64_t suspending = before + (after - before) / 2;
+  return static_cast<int64_t>(wall - suspending);
+}
+#endif
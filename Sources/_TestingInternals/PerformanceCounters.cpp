@@ -0,0 +1,199 @@
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for Swift project authors
+//
+
+#include "PerformanceCounters.h"
+
+#if defined(__linux__) && __has_include(<linux/perf_event.h>)
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+
+namespace {
+/// A type describing a performance counter to open.
+struct CounterDescriptor {
+  /// The `perf_event_attr.type` value of the counter.
+  uint32_t type;
+
+  /// The `perf_event_attr.config` value of the counter.
+  uint64_t config;
+
+  /// A pointer to the field in ``SWTPerformanceCounterValues`` that holds the
+  /// value of this counter.
+  int64_t SWTPerformanceCounterValues:: *value;
+};
+
+/// The counters opened by ``swt_performanceCountersStart()``.
+constexpr CounterDescriptor counterDescriptors[] = {
+  { PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS, &SWTPerformanceCounterValues::instructions },
+  { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES, &SWTPerformanceCounterValues::cycles },
+  { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES, &SWTPerformanceCounterValues::cacheMisses },
+  { PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES, &SWTPerformanceCounterValues::branchMisses },
+  { PERF_TYPE_SOFTWARE, PERF_COUNT_SW_TASK_CLOCK, &SWTPerformanceCounterValues::taskClockNanoseconds },
+  { PERF_TYPE_SOFTWARE, PERF_COUNT_SW_PAGE_FAULTS, &SWTPerformanceCounterValues::pageFaults },
+};
+
+/// The number of counters opened by ``swt_performanceCountersStart()``.
+constexpr size_t counterCount = std::size(counterDescriptors);
+
+/// Whether or not each counter has failed to open for a reason that will not
+/// change while the process runs.
+///
+/// Counters that fail this way are not retried. Other failures (such as
+/// running out of file descriptors) are transient, so those counters are
+/// retried the next time counters are started.
+std::atomic<bool> counterIsUnavailable[counterCount];
+
+/// Check whether an error from `perf_event_open()` means the counter that
+/// could not be opened will never be available to the current process.
+///
+/// - Parameters:
+///   - errorCode: The error code reported by `perf_event_open()`.
+///
+/// - Returns: Whether or not `errorCode` describes missing hardware or kernel
+///   support, or insufficient privileges.
+bool isPersistentOpenError(int errorCode) {
+  switch (errorCode) {
+  case ENOENT:
+  case EACCES:
+  case EPERM:
+  case EOPNOTSUPP:
+  case EINVAL:
+    return true;
+  default:
+    return false;
+  }
+}
+
+/// Open a performance counter for the current thread.
+///
+/// - Parameters:
+///   - descriptor: The counter to open.
+///
+/// - Returns: A file descriptor for the counter, or `-1` if it could not be
+///   opened. The counter is initially disabled.
+int openCounter(const CounterDescriptor& descriptor) {
+  perf_event_attr attr {};
+  attr.size = sizeof(attr);
+  attr.type = descriptor.type;
+  attr.config = descriptor.config;
+  attr.disabled = 1;
+  attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+  if (descriptor.type == PERF_TYPE_HARDWARE) {
+    // Counting only user-space events allows hardware counters to be opened
+    // under the default perf_event_paranoid setting and excludes noise from
+    // interrupts serviced on behalf of other processes.
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+  }
+  return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, PERF_FLAG_FD_CLOEXEC));
+}
+
+/// Get the ID of the current thread.
+pid_t currentThreadID(void) {
+  return static_cast<pid_t>(syscall(SYS_gettid));
+}
+}
+
+struct SWTPerformanceCounters {
+  /// The file descriptors of the open counters, or `-1` for counters that are
+  /// not open.
+  int fds[counterCount];
+
+  /// The thread that opened the counters.
+  pid_t threadID;
+};
+
+SWTPerformanceCounters *swt_performanceCountersStart(void) {
+  int fds[counterCount];
+  bool anyCounterIsOpen = false;
+  for (size_t i = 0; i < counterCount; i++) {
+    fds[i] = -1;
+    if (!counterIsUnavailable[i].load(std::memory_order_relaxed)) {
+      fds[i] = openCounter(counterDescriptors[i]);
+      if (fds[i] == -1) {
+        if (isPersistentOpenError(errno)) {
+          counterIsUnavailable[i].store(true, std::memory_order_relaxed);
+        }
+      } else {
+        anyCounterIsOpen = true;
+      }
+    }
+  }
+  if (!anyCounterIsOpen) {
+    return nullptr;
+  }
+
+  auto result = new SWTPerformanceCounters;
+  result->threadID = currentThreadID();
+  std::copy(std::begin(fds), std::end(fds), std::begin(result->fds));
+
+  // Enable the counters as late as possible so that opening them is not
+  // counted.
+  for (int fd : result->fds) {
+    if (fd != -1) {
+      (void)ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+      (void)ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+    }
+  }
+  return result;
+}
+
+bool swt_performanceCountersStop(SWTPerformanceCounters *counters, SWTPerformanceCounterValues *outValues) {
+  // Disable the counters as early as possible so that reading and closing them
+  // is not counted.
+  for (int fd : counters->fds) {
+    if (fd != -1) {
+      (void)ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+    }
+  }
+
+  *outValues = { -1, -1, -1, -1, -1, -1 };
+  for (size_t i = 0; i < counterCount; i++) {
+    int fd = counters->fds[i];
+    if (fd == -1) {
+      continue;
+    }
+
+    struct {
+      uint64_t value;
+      uint64_t timeEnabled;
+      uint64_t timeRunning;
+    } reading {};
+    if (read(fd, &reading, sizeof(reading)) == sizeof(reading) && reading.timeRunning > 0) {
+      // If the kernel multiplexed this counter with others, it only counted
+      // for part of the time it was enabled. Scale its value accordingly.
+      auto value = reading.value;
+      if (reading.timeRunning < reading.timeEnabled) {
+        value = static_cast<uint64_t>(static_cast<long double>(value) * reading.timeEnabled / reading.timeRunning);
+      }
+      outValues->*(counterDescriptors[i].value) = static_cast<int64_t>(value);
+    }
+    (void)close(fd);
+  }
+
+  bool isSameThread = counters->threadID == currentThreadID();
+  delete counters;
+  return isSameThread;
+}
+#else
+SWTPerformanceCounters *swt_performanceCountersStart(void) {
+  return nullptr;
+}
+
+bool swt_performanceCountersStop(SWTPerformanceCounters *counters, SWTPerformanceCounterValues *outValues) {
+  (void)counters;
+  *outValues = { -1, -1, -1, -1, -1, -1 };
+  return false;
+}
+#endif
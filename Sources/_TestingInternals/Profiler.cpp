@@ -0,0 +1,215 @@
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for Swift project authors
+//
+
+#include "Profiler.h"
+
+#if defined(__linux__) && __has_include(<execinfo.h>) && __has_include(<sys/time.h>)
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <mutex>
+
+#include <sys/syscall.h>
+#include <sys/time.h>
+
+namespace {
+/// The maximum number of samples stored during a single profiling session.
+///
+/// At the default sampling interval of one millisecond, this is enough storage
+/// for about eight seconds of CPU time.
+constexpr size_t maximumSampleCount = 8192;
+
+/// The maximum number of addresses captured in each sample.
+constexpr size_t maximumAddressCount = 64;
+
+/// The number of frames at the top of each captured backtrace that belong to
+/// the signal handler rather than to the interrupted code.
+///
+/// These are the frames of ``handleProfilingSignal()`` and of the C library's
+/// signal trampoline.
+constexpr size_t handlerFrameCount = 2;
+
+/// Storage for a single sample.
+struct Sample {
+  /// The thread that was sampled.
+  uint64_t threadID;
+
+  /// The number of addresses captured, including the frames of the signal
+  /// handler.
+  size_t addressCount;
+
+  /// Whether or not this sample has been completely captured.
+  std::atomic<bool> isComplete;
+
+  /// The captured addresses.
+  void *addresses[maximumAddressCount + handlerFrameCount];
+};
+
+/// Storage for the samples of the current profiling session.
+///
+/// Like the storage used by ``swt_withAllThreadBacktraces()``, this storage is
+/// allocated before profiling first starts and is never deallocated.
+Sample *samples = nullptr;
+
+/// Whether or not a profiling session is active.
+std::atomic<bool> isRunning { false };
+
+/// Whether or not signal handlers should store samples in ``samples``.
+std::atomic<bool> isAccepting { false };
+
+/// The index of the next sample in ``samples`` to claim.
+std::atomic<size_t> nextSampleIndex { 0 };
+
+/// The number of signal handlers currently running.
+std::atomic<size_t> activeHandlerCount { 0 };
+
+/// A mutex guarding the one-time installation of the signal handler.
+std::mutex installMutex;
+
+/// The signal handler that samples the thread it runs on.
+///
+/// Only async-signal-safe operations are performed here: `backtrace()` is safe
+/// to call once its unwinder has been loaded by ``installSignalHandler()``.
+void handleProfilingSignal(int, siginfo_t *, void *) {
+  int savedErrno = errno;
+  activeHandlerCount.fetch_add(1);
+  if (isAccepting.load()) {
+    size_t sampleIndex = nextSampleIndex.fetch_add(1);
+    if (sampleIndex < maximumSampleCount) {
+      Sample& sample = samples[sampleIndex];
+      sample.threadID = static_cast<uint64_t>(syscall(SYS_gettid));
+      sample.addressCount = static_cast<size_t>(backtrace(sample.addresses, static_cast<int>(std::size(sample.addresses))));
+      sample.isComplete.store(true, std::memory_order_release);
+    }
+  }
+  activeHandlerCount.fetch_sub(1);
+  errno = savedErrno;
+}
+
+/// Allocate ``samples`` and install ``handleProfilingSignal()``, if that has
+/// not already been done.
+///
+/// - Returns: Whether or not the signal handler is installed.
+bool installSignalHandler(void) {
+  std::lock_guard lock(installMutex);
+  static bool isInstalled = false;
+  if (isInstalled) {
+    return true;
+  }
+
+  struct sigaction oldAction {};
+  if (0 != sigaction(SIGPROF, nullptr, &oldAction)) {
+    return false;
+  }
+  if ((oldAction.sa_flags & SA_SIGINFO) == 0 && oldAction.sa_handler != SIG_DFL) {
+    // Someone else is using this signal.
+    return false;
+  } else if ((oldAction.sa_flags & SA_SIGINFO) != 0 && oldAction.sa_sigaction != handleProfilingSignal) {
+    return false;
+  }
+
+  // The first call to backtrace() may load the unwinder and allocate memory,
+  // neither of which is safe to do from within a signal handler.
+  void *warmUpAddresses[1];
+  (void)backtrace(warmUpAddresses, 1);
+
+  samples = new Sample[maximumSampleCount];
+
+  struct sigaction action {};
+  action.sa_sigaction = handleProfilingSignal;
+  action.sa_flags = SA_SIGINFO | SA_RESTART;
+  sigemptyset(&action.sa_mask);
+  if (0 != sigaction(SIGPROF, &action, nullptr)) {
+    return false;
+  }
+  isInstalled = true;
+  return true;
+}
+
+/// Arm or disarm the profiling timer.
+///
+/// - Parameters:
+///   - intervalMicroseconds: The interval of the timer, or `0` to disarm it.
+///
+/// - Returns: Whether or not the timer was updated.
+bool setProfilingTimer(uint32_t intervalMicroseconds) {
+  struct itimerval timer {};
+  timer.it_interval.tv_sec = intervalMicroseconds / 1000000;
+  timer.it_interval.tv_usec = intervalMicroseconds % 1000000;
+  timer.it_value = timer.it_interval;
+  return 0 == setitimer(ITIMER_PROF, &timer, nullptr);
+}
+}
+
+bool swt_profilerStart(uint32_t sampleIntervalMicroseconds) {
+  if (sampleIntervalMicroseconds == 0 || !installSignalHandler()) {
+    return false;
+  }
+
+  bool wasRunning = false;
+  if (!isRunning.compare_exchange_strong(wasRunning, true)) {
+    return false;
+  }
+
+  // Wait for any handler from the previous session that received its signal
+  // after the timer was disarmed. Handlers do not block, so this is brief.
+  while (activeHandlerCount.load() != 0) {
+    sched_yield();
+  }
+  for (size_t i = 0; i < maximumSampleCount; i++) {
+    samples[i].isComplete.store(false, std::memory_order_relaxed);
+  }
+  nextSampleIndex.store(0);
+  isAccepting.store(true);
+
+  if (!setProfilingTimer(sampleIntervalMicroseconds)) {
+    isAccepting.store(false);
+    isRunning.store(false);
+    return false;
+  }
+  return true;
+}
+
+void swt_profilerStop(SWTProfilerSamplesHandler body, void *context) {
+  (void)setProfilingTimer(0);
+  isAccepting.store(false);
+  while (activeHandlerCount.load() != 0) {
+    sched_yield();
+  }
+
+  // Gather the samples that were completely captured, omitting the frames of
+  // the signal handler itself.
+  size_t takenSampleCount = nextSampleIndex.load();
+  size_t sampleCount = std::min(takenSampleCount, maximumSampleCount);
+  auto result = new SWTThreadBacktrace[sampleCount];
+  size_t resultCount = 0;
+  for (size_t i = 0; i < sampleCount; i++) {
+    const Sample& sample = samples[i];
+    if (sample.isComplete.load(std::memory_order_acquire) && sample.addressCount > handlerFrameCount) {
+      result[resultCount] = { sample.threadID, sample.addresses + handlerFrameCount, sample.addressCount - handlerFrameCount };
+      resultCount += 1;
+    }
+  }
+  body(result, resultCount, takenSampleCount - sampleCount, context);
+  delete [] result;
+
+  isRunning.store(false);
+}
+#else
+bool swt_profilerStart(uint32_t sampleIntervalMicroseconds) {
+  (void)sampleIntervalMicroseconds;
+  return false;
+}
+
+void swt_profilerStop(SWTProfilerSamplesHandler body, void *context) {
+  (void)body;
+  (void)context;
+}
+#endif
@@ -0,0 +1,144 @@
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for Swift project authors
+//
+
+#include "RingBuffer.h"
+
+#if !SWT_NO_FILE_IO && (defined(__APPLE__) || defined(__linux__) || defined(__FreeBSD__) || defined(__ANDROID__))
+#include <algorithm>
+#include <atomic>
+#include <sched.h>
+
+static_assert(sizeof(SWTRingBufferHeader) == 256, "SWTRingBufferHeader is part of the ABI and must not change size");
+static_assert(offsetof(SWTRingBufferHeader, readOffset) == 64, "SWTRingBufferHeader is part of the ABI and must not change layout");
+static_assert(offsetof(SWTRingBufferHeader, droppedRecordCount) == 128, "SWTRingBufferHeader is part of the ABI and must not change layout");
+static_assert(offsetof(SWTRingBufferHeader, isReaderClosed) == 136, "SWTRingBufferHeader is part of the ABI and must not change layout");
+static_assert(offsetof(SWTRingBufferHeader, isReaderStalled) == 140, "SWTRingBufferHeader is part of the ABI and must not change layout");
+static_assert(offsetof(SWTRingBufferHeader, stalledReadOffset) == 144, "SWTRingBufferHeader is part of the ABI and must not change layout");
+static_assert(std::atomic_ref<uint64_t>::is_always_lock_free && std::atomic_ref<uint32_t>::is_always_lock_free,
+  "uint64_t and uint32_t must be lock-free on all supported targets");
+
+namespace {
+/// Copy bytes into the data area of a ring buffer, wrapping around its end.
+///
+/// - Parameters:
+///   - data: The start of the data area.
+///   - capacity: The size of the data area in bytes.
+///   - offset: The stream offset at which to copy the bytes.
+///   - bytes: The bytes to copy.
+///   - count: The number of bytes to copy. Must not exceed `capacity`.
+void copyIntoRingBuffer(uint8_t *data, size_t capacity, uint64_t offset, const void *bytes, size_t count) {
+  auto position = static_cast<size_t>(offset % capacity);
+  auto firstCount = std::min(count, capacity - position);
+  auto source = static_cast<const uint8_t *>(bytes);
+  std::copy(source, source + firstCount, data + position);
+  std::copy(source + firstCount, source + count, data);
+}
+
+/// Get the current time on the monotonic clock, in milliseconds.
+uint64_t nowMilliseconds(void) {
+  struct timespec now {};
+  (void)clock_gettime(CLOCK_MONOTONIC, &now);
+  return static_cast<uint64_t>(now.tv_sec) * 1000 + static_cast<uint64_t>(now.tv_nsec) / 1000000;
+}
+
+/// Wait briefly for the reader of a ring buffer to make progress.
+///
+/// - Parameters:
+///   - attempt: The number of times this function has already been called
+///     while waiting for the same write.
+///
+/// The first few calls yield the current thread; later calls sleep so that a
+/// slow reader does not cause the writer to consume a whole CPU core.
+void waitForReader(unsigned attempt) {
+  if (attempt < 64) {
+    (void)sched_yield();
+  } else {
+    struct timespec interval = { 0, 50'000 };
+    (void)nanosleep(&interval, nullptr);
+  }
+}
+}
+
+bool swt_ringBufferWrite(void *buffer, size_t bufferSize, int notificationFD, const void *record, size_t recordSize) {
+  auto header = static_cast<SWTRingBufferHeader *>(buffer);
+  auto data = static_cast<uint8_t *>(buffer) + sizeof(SWTRingBufferHeader);
+  size_t capacity = bufferSize > sizeof(SWTRingBufferHeader) ? bufferSize - sizeof(SWTRingBufferHeader) : 0;
+
+  std::atomic_ref droppedRecordCount(header->droppedRecordCount);
+  std::atomic_ref isReaderClosed(header->isReaderClosed);
+  auto length = static_cast<uint32_t>(recordSize);
+  size_t frameSize = sizeof(length) + recordSize;
+  if (recordSize > UINT32_MAX || frameSize > capacity || isReaderClosed.load(std::memory_order_acquire) != 0) {
+    droppedRecordCount.fetch_add(1, std::memory_order_relaxed);
+    return false;
+  }
+
+  std::atomic_ref writeOffset(header->writeOffset);
+  std::atomic_ref readOffset(header->readOffset);
+  std::atomic_ref isReaderStalled(header->isReaderStalled);
+  std::atomic_ref stalledReadOffset(header->stalledReadOffset);
+
+  // This function is the only writer, so the write offset and the stall state
+  // cannot change underneath it. Wait until the reader has freed enough space,
+  // but do not wait for a reader that has stopped reading or that is not
+  // making progress: callers serialize writes, so a stalled reader would
+  // otherwise stall every thread that produces records.
+  uint64_t offset = writeOffset.load(std::memory_order_relaxed);
+  if (isReaderStalled.load(std::memory_order_relaxed) != 0
+      && readOffset.load(std::memory_order_acquire) != stalledReadOffset.load(std::memory_order_relaxed)) {
+    // The reader has made progress since the last write timed out.
+    isReaderStalled.store(0, std::memory_order_relaxed);
+  }
+  uint64_t deadline = 0;
+  for (unsigned attempt = 0; ; attempt++) {
+    uint64_t currentReadOffset = readOffset.load(std::memory_order_acquire);
+    if (capacity - (offset - currentReadOffset) >= frameSize) {
+      break;
+    }
+    if (attempt == 0) {
+      if (isReaderStalled.load(std::memory_order_relaxed) != 0) {
+        // The reader has not made any progress since the last write timed
+        // out, so do not wait for it again.
+        droppedRecordCount.fetch_add(1, std::memory_order_relaxed);
+        return false;
+      }
+      deadline = nowMilliseconds() + SWT_RING_BUFFER_WRITE_TIMEOUT_MILLISECONDS;
+    } else if (isReaderClosed.load(std::memory_order_acquire) != 0) {
+      droppedRecordCount.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    } else if (nowMilliseconds() >= deadline) {
+      stalledReadOffset.store(currentReadOffset, std::memory_order_relaxed);
+      isReaderStalled.store(1, std::memory_order_relaxed);
+      droppedRecordCount.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+    waitForReader(attempt);
+  }
+
+  copyIntoRingBuffer(data, capacity, offset, &length, sizeof(length));
+  copyIntoRingBuffer(data, capacity, offset + sizeof(length), record, recordSize);
+
+  // Publish the record. Both this store and the load of the read offset below
+  // are sequentially consistent so that, if the reader concurrently drains the
+  // ring buffer and then checks whether it is empty before waiting for a
+  // notification, either it observes this record or this function observes
+  // that the ring buffer was empty and notifies it.
+  writeOffset.store(offset + frameSize);
+  if (notificationFD >= 0 && readOffset.load() == offset) {
+    uint64_t one = 1;
+    ssize_t result;
+    do {
+      result = write(notificationFD, &one, sizeof(one));
+    } while (result == -1 && errno == EINTR);
+  }
+
+  return true;
+}
+#endif
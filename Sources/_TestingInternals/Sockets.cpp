@@ -0,0 +1,101 @@
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for Swift project authors
+//
+
+#include "Sockets.h"
+
+#if !SWT_NO_FILE_IO && (defined(__APPLE__) || defined(__linux__) || defined(__FreeBSD__) || defined(__ANDROID__))
+#include <sys/socket.h>
+#include <sys/un.h>
+
+namespace {
+/// Create a Unix domain stream socket and the address of a path.
+///
+/// - Parameters:
+///   - path: The path the socket will be bound or connected to.
+///   - address: On successful return, the address of `path`.
+///
+/// - Returns: A file descriptor for the new socket, or `-1` if an error
+///   occurred, in which case `errno` is set.
+int makeSocket(const char *path, struct sockaddr_un& address) {
+  address = {};
+  address.sun_family = AF_UNIX;
+  size_t pathLength = strlen(path);
+  if (pathLength >= sizeof(address.sun_path)) {
+    errno = ENAMETOOLONG;
+    return -1;
+  }
+  memcpy(address.sun_path, path, pathLength + 1);
+
+  int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (fd == -1) {
+    return -1;
+  }
+  (void)fcntl(fd, F_SETFD, FD_CLOEXEC);
+  return fd;
+}
+}
+
+int swt_unixDomainSocketListen(const char *path) {
+  struct sockaddr_un address;
+  int fd = makeSocket(path, address);
+  if (fd == -1) {
+    return -1;
+  }
+
+  if (-1 == bind(fd, reinterpret_cast<const struct sockaddr *>(&address), sizeof(address))
+      || -1 == listen(fd, SOMAXCONN)) {
+    int errorCode = errno;
+    (void)close(fd);
+    errno = errorCode;
+    return -1;
+  }
+  return fd;
+}
+
+int swt_unixDomainSocketAccept(int fd) {
+  int result;
+  do {
+    result = accept(fd, nullptr, nullptr);
+  } while (result == -1 && errno == EINTR);
+  if (result == -1) {
+    return -1;
+  }
+  (void)fcntl(result, F_SETFD, FD_CLOEXEC);
+#if defined(SO_NOSIGPIPE)
+  int yes = 1;
+  (void)setsockopt(result, SOL_SOCKET, SO_NOSIGPIPE, &yes, sizeof(yes));
+#endif
+  return result;
+}
+
+int swt_unixDomainSocketConnect(const char *path) {
+  struct sockaddr_un address;
+  int fd = makeSocket(path, address);
+  if (fd == -1) {
+    return -1;
+  }
+
+  int result;
+  do {
+    result = connect(fd, reinterpret_cast<const struct sockaddr *>(&address), sizeof(address));
+  } while (result == -1 && errno == EINTR);
+  if (result == -1) {
+    int errorCode = errno;
+    (void)close(fd);
+    errno = errorCode;
+    return -1;
+  }
+#if defined(SO_NOSIGPIPE)
+  int yes = 1;
+  (void)setsockopt(fd, SOL_SOCKET, SO_NOSIGPIPE, &yes, sizeof(yes));
+#endif
+  return fd;
+}
+#endif
@@ -28,6 +28,24 @@
 int swt_pthread_setname_np(pthread_t thread, const char *name) {
   return pthread_setname_np(thread, name);
 }
+
+int swt_pthread_mutex_init_adaptive_np(pthread_mutex_t *mutex) {
+#if defined(__GLIBC__)
+  pthread_mutexattr_t attrs;
+  int result = pthread_mutexattr_init(&attrs);
+  if (result == 0) {
+    result = pthread_mutexattr_settype(&attrs, PTHREAD_MUTEX_ADAPTIVE_NP);
+    if (result == 0) {
+      result = pthread_mutex_init(mutex, &attrs);
+    }
+    (void)pthread_mutexattr_destroy(&attrs);
+  }
+  if (result == 0) {
+    return 0;
+  }
+#endif
+  return pthread_mutex_init(mutex, nullptr);
+}
 #endif
 
 #if defined(__GLIBC__)
@@ -0,0 +1,226 @@
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for Swift project authors
+//
+
+#include "ThreadBacktraces.h"
+
+#if defined(__linux__) && __has_include(<execinfo.h>) && __has_include(<dirent.h>)
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+
+#include <dirent.h>
+#include <sys/syscall.h>
+
+namespace {
+/// The maximum number of threads whose backtraces can be captured at once.
+constexpr size_t maximumThreadCount = 1024;
+
+/// The maximum number of addresses captured in each thread's backtrace.
+constexpr size_t maximumAddressCount = 128;
+
+/// Storage for a single thread's backtrace.
+struct Slot {
+  /// The thread that captured this backtrace.
+  uint64_t threadID;
+
+  /// The number of addresses captured.
+  size_t addressCount;
+
+  /// Whether or not the backtrace in this slot has been completely captured.
+  std::atomic<bool> isComplete;
+
+  /// The captured addresses.
+  void *addresses[maximumAddressCount];
+};
+
+/// Storage for the backtraces of all threads.
+///
+/// This storage is allocated before any thread is signalled and is never
+/// deallocated, so a signal handler that runs after its capture has timed out
+/// cannot write to freed memory.
+Slot *slots = nullptr;
+
+/// Whether or not signal handlers should capture backtraces into ``slots``.
+std::atomic<bool> isAccepting { false };
+
+/// The index of the next slot in ``slots`` to claim.
+std::atomic<size_t> nextSlotIndex { 0 };
+
+/// The number of signal handlers that have finished since the current capture
+/// started.
+std::atomic<size_t> respondedCount { 0 };
+
+/// The number of signal handlers currently running.
+std::atomic<size_t> activeHandlerCount { 0 };
+
+/// A mutex serializing calls to ``swt_withAllThreadBacktraces()``.
+std::mutex captureMutex;
+
+/// Get the ID of the current thread.
+pid_t currentThreadID(void) {
+  return static_cast<pid_t>(syscall(SYS_gettid));
+}
+
+/// Get the signal used to request backtraces from other threads.
+///
+/// The signal is chosen from the top of the real-time range because the
+/// bottom of the range is used by the C library and by most other clients.
+int captureSignal(void) {
+  return SIGRTMAX - 2;
+}
+
+/// The signal handler that captures the backtrace of the thread it runs on.
+///
+/// Only async-signal-safe operations are performed here: `backtrace()` is safe
+/// to call once its unwinder has been loaded by ``installSignalHandler()``.
+void handleCaptureSignal(int, siginfo_t *, void *) {
+  int savedErrno = errno;
+  activeHandlerCount.fetch_add(1);
+  if (isAccepting.load()) {
+    size_t slotIndex = nextSlotIndex.fetch_add(1);
+    if (slotIndex < maximumThreadCount) {
+      Slot& slot = slots[slotIndex];
+      slot.threadID = static_cast<uint64_t>(currentThreadID());
+      slot.addressCount = static_cast<size_t>(backtrace(slot.addresses, static_cast<int>(maximumAddressCount)));
+      slot.isComplete.store(true, std::memory_order_release);
+    }
+    respondedCount.fetch_add(1);
+  }
+  activeHandlerCount.fetch_sub(1);
+  errno = savedErrno;
+}
+
+/// Allocate ``slots`` and install ``handleCaptureSignal()``, if that has not
+/// already been done.
+///
+/// - Returns: Whether or not the signal handler is installed.
+///
+/// This function must be called while ``captureMutex`` is held.
+bool installSignalHandler(void) {
+  static bool isInstalled = false;
+  if (isInstalled) {
+    return true;
+  }
+
+  struct sigaction oldAction {};
+  if (0 != sigaction(captureSignal(), nullptr, &oldAction)) {
+    return false;
+  }
+  if ((oldAction.sa_flags & SA_SIGINFO) == 0 && oldAction.sa_handler != SIG_DFL) {
+    // Someone else is using this signal.
+    return false;
+  } else if ((oldAction.sa_flags & SA_SIGINFO) != 0 && oldAction.sa_sigaction != handleCaptureSignal) {
+    return false;
+  }
+
+  // The first call to backtrace() may load the unwinder and allocate memory,
+  // neither of which is safe to do from within a signal handler.
+  void *warmUpAddresses[1];
+  (void)backtrace(warmUpAddresses, 1);
+
+  slots = new Slot[maximumThreadCount];
+
+  struct sigaction action {};
+  action.sa_sigaction = handleCaptureSignal;
+  action.sa_flags = SA_SIGINFO | SA_RESTART;
+  sigemptyset(&action.sa_mask);
+  if (0 != sigaction(captureSignal(), &action, nullptr)) {
+    return false;
+  }
+  isInstalled = true;
+  return true;
+}
+
+/// Get the current time on the monotonic clock, in milliseconds.
+uint64_t nowMilliseconds(void) {
+  struct timespec now {};
+  (void)clock_gettime(CLOCK_MONOTONIC, &now);
+  return static_cast<uint64_t>(now.tv_sec) * 1000 + static_cast<uint64_t>(now.tv_nsec) / 1000000;
+}
+
+/// Sleep briefly while waiting for signal handlers to finish.
+void sleepBriefly(void) {
+  struct timespec interval { 0, 1000000 };
+  (void)nanosleep(&interval, nullptr);
+}
+}
+
+bool swt_withAllThreadBacktraces(uint32_t timeoutMilliseconds, SWTThreadBacktracesHandler body, void *context) {
+  std::lock_guard lock(captureMutex);
+  if (!installSignalHandler()) {
+    return false;
+  }
+
+  // If a signal handler from an earlier capture that timed out is still
+  // running, its slot cannot safely be reused.
+  if (activeHandlerCount.load() != 0) {
+    return false;
+  }
+  for (size_t i = 0; i < maximumThreadCount; i++) {
+    slots[i].isComplete.store(false, std::memory_order_relaxed);
+  }
+  nextSlotIndex.store(0);
+  respondedCount.store(0);
+  isAccepting.store(true);
+
+  // Signal every other thread in the process.
+  size_t signalledCount = 0;
+  pid_t processID = getpid();
+  pid_t currentThread = currentThreadID();
+  if (DIR *taskDir = opendir("/proc/self/task")) {
+    while (struct dirent *entry = readdir(taskDir)) {
+      char *end = nullptr;
+      long threadID = strtol(entry->d_name, &end, 10);
+      if (end == entry->d_name || *end != '\0' || threadID == currentThread) {
+        continue;
+      }
+      if (0 == syscall(SYS_tgkill, processID, static_cast<pid_t>(threadID), captureSignal())) {
+        signalledCount += 1;
+      }
+    }
+    (void)closedir(taskDir);
+  }
+
+  // Wait for the signalled threads to respond, then stop accepting new
+  // backtraces and wait (within the same deadline) for any handlers that are
+  // still capturing.
+  uint64_t deadline = nowMilliseconds() + timeoutMilliseconds;
+  while (respondedCount.load() < signalledCount && nowMilliseconds() < deadline) {
+    sleepBriefly();
+  }
+  isAccepting.store(false);
+  while (activeHandlerCount.load() != 0 && nowMilliseconds() < deadline) {
+    sleepBriefly();
+  }
+
+  // Gather the backtraces that were completely captured.
+  size_t slotCount = std::min(nextSlotIndex.load(), maximumThreadCount);
+  auto backtraces = new SWTThreadBacktrace[slotCount];
+  size_t backtraceCount = 0;
+  for (size_t i = 0; i < slotCount; i++) {
+    const Slot& slot = slots[i];
+    if (slot.isComplete.load(std::memory_order_acquire)) {
+      backtraces[backtraceCount] = { slot.threadID, slot.addresses, slot.addressCount };
+      backtraceCount += 1;
+    }
+  }
+  body(backtraces, backtraceCount, context);
+  delete [] backtraces;
+
+  return true;
+}
+#else
+bool swt_withAllThreadBacktraces(uint32_t timeoutMilliseconds, SWTThreadBacktracesHandler body, void *context) {
+  (void)timeoutMilliseconds;
+  (void)body;
+  (void)context;
+  return false;
+}
+#endif
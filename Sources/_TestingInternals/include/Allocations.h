@@ -0,0 +1,73 @@
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for Swift project authors
+//
+
+#if !defined(SWT_ALLOCATIONS_H)
+#define SWT_ALLOCATIONS_H
+
+#include "Defines.h"
+#include "Includes.h"
+
+SWT_ASSUME_NONNULL_BEGIN
+
+/// A structure describing the heap allocations made while allocations were
+/// being tracked.
+typedef struct SWTAllocationCounts {
+  /// The number of blocks allocated.
+  uint64_t allocationCount;
+
+  /// The number of blocks deallocated.
+  uint64_t deallocationCount;
+
+  /// The total usable size, in bytes, of all blocks allocated.
+  uint64_t allocatedByteCount;
+
+  /// The total usable size, in bytes, of all blocks deallocated.
+  uint64_t deallocatedByteCount;
+} SWTAllocationCounts;
+
+/// Check whether or not allocation tracking is available.
+///
+/// - Returns: Whether or not the testing library was built with support for
+///   tracking heap allocations on the current platform.
+///
+/// Allocation tracking interposes `malloc()`, `free()`, and related functions
+/// for the whole process, so it is only available when the testing library is
+/// built with `SWT_ENABLE_ALLOCATION_TRACKING` defined. It is currently only
+/// supported on platforms that use glibc, and should not be enabled in
+/// processes that replace the system allocator (for example, with jemalloc.)
+SWT_EXTERN bool swt_allocationTrackingIsAvailable(void);
+
+/// Begin tracking the heap allocations made by the current thread.
+///
+/// - Returns: An opaque token identifying the tracking session, or `nullptr`
+///   if allocation tracking is not available.
+///
+/// Allocations made by the current thread are counted until
+/// ``swt_allocationTrackingEnd()`` is called with the returned token. If
+/// allocations were already being tracked by the current thread, that session
+/// is suspended until the new one ends. Allocations made by other threads are
+/// not counted.
+SWT_EXTERN const void *_Nullable swt_allocationTrackingBegin(void);
+
+/// Stop tracking heap allocations.
+///
+/// - Parameters:
+///   - token: The token returned by ``swt_allocationTrackingBegin()``. After
+///     this function returns, `token` is no longer valid.
+///   - outCounts: On return, the allocations counted during the session.
+///
+/// - Returns: Whether or not this function was called on the same thread as
+///   the corresponding call to ``swt_allocationTrackingBegin()``. If it was
+///   not, the counts in `outCounts` are incomplete.
+SWT_EXTERN bool swt_allocationTrackingEnd(const void *token, SWTAllocationCounts *outCounts);
+
+SWT_ASSUME_NONNULL_END
+
+#endif
@@ -0,0 +1,71 @@
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for Swift project authors
+//
+
+#if !defined(SWT_ATOMICS_H)
+#define SWT_ATOMICS_H
+
+#include "Defines.h"
+#include "Includes.h"
+
+SWT_ASSUME_NONNULL_BEGIN
+
+/// Atomically load an integer.
+///
+/// - Parameters:
+///   - address: The address of the integer to load. This address must be
+///     suitably aligned for an `intptr_t` and must only be accessed using the
+///     functions declared in this header.
+///
+/// - Returns: The value stored at `address`.
+///
+/// This function uses sequentially-consistent memory ordering. It is
+/// implemented using `std::atomic_ref` because Swift cannot import C11 atomic
+/// types and the standard library's `Synchronization` module is not available
+/// on all deployment targets the testing library supports.
+SWT_EXTERN intptr_t swt_atomic_load(const intptr_t *address);
+
+/// Atomically store an integer.
+///
+/// - Parameters:
+///   - address: The address of the integer to store.
+///   - value: The value to store at `address`.
+///
+/// This function uses sequentially-consistent memory ordering.
+SWT_EXTERN void swt_atomic_store(intptr_t *address, intptr_t value);
+
+/// Atomically add to an integer.
+///
+/// - Parameters:
+///   - address: The address of the integer to modify.
+///   - addend: The value to add to the integer at `address`.
+///
+/// - Returns: The value stored at `address` _before_ `addend` was added.
+///
+/// This function uses sequentially-consistent memory ordering. Overflow wraps
+/// around.
+SWT_EXTERN intptr_t swt_atomic_fetch_add(intptr_t *address, intptr_t addend);
+
+/// Atomically replace an integer if it has an expected value.
+///
+/// - Parameters:
+///   - address: The address of the integer to modify.
+///   - expected: On input, the value the integer at `address` is expected to
+///     have. On output, the value it had before this function was called.
+///   - desired: The value to store at `address` if it equals `*expected`.
+///
+/// - Returns: Whether or not `desired` was stored at `address`.
+///
+/// This function uses sequentially-consistent memory ordering. It does not
+/// fail spuriously.
+SWT_EXTERN bool swt_atomic_compare_exchange(intptr_t *address, intptr_t *expected, intptr_t desired);
+
+SWT_ASSUME_NONNULL_END
+
+#endif
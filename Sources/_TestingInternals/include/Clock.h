@@ -0,0 +1,45 @@
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for Swift project authors
+//
+
+#if !defined(SWT_CLOCK_H)
+#define SWT_CLOCK_H
+
+#include "Defines.h"
+#include "Includes.h"
+
+SWT_ASSUME_NONNULL_BEGIN
+
+#if defined(__APPLE__) || defined(__linux__) || defined(__ANDROID__)
+/// Get the current time on the suspending clock.
+///
+/// - Returns: The number of nanoseconds since the suspending clock's epoch.
+///
+/// This function reads the same clock as `SuspendingClock` in the Swift
+/// standard library (`CLOCK_UPTIME_RAW` on Darwin and `CLOCK_MONOTONIC` on
+/// Linux and Android), so values it returns can be converted to instances of
+/// `SuspendingClock.Instant`. Both clocks are read from user space via the
+/// commpage or vDSO without making a system call.
+SWT_EXTERN uint64_t swt_clock_suspendingNanoseconds(void);
+
+/// Get the current offset of the wall clock from the suspending clock.
+///
+/// - Returns: The number of nanoseconds to add to a value returned by
+///   ``swt_clock_suspendingNanoseconds()`` to convert it to the number of
+///   nanoseconds since the UNIX epoch (1970-01-01 00:00:00 UT).
+///
+/// The offset changes when the wall clock is adjusted or, on Darwin, when the
+/// system sleeps, so callers should get it when they need to convert a value
+/// rather than caching it.
+SWT_EXTERN int64_t swt_clock_wallOffsetNanoseconds(void);
+#endif
+
+SWT_ASSUME_NONNULL_END
+
+#endif
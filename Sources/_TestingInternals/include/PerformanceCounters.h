@@ -0,0 +1,78 @@
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for Swift project authors
+//
+
+#if !defined(SWT_PERFORMANCECOUNTERS_H)
+#define SWT_PERFORMANCECOUNTERS_H
+
+#include "Defines.h"
+#include "Includes.h"
+
+SWT_ASSUME_NONNULL_BEGIN
+
+/// A structure describing the values of a set of performance counters.
+///
+/// Each value is `-1` if the corresponding counter was not available.
+typedef struct SWTPerformanceCounterValues {
+  /// The number of instructions retired.
+  int64_t instructions;
+
+  /// The number of CPU cycles elapsed.
+  int64_t cycles;
+
+  /// The number of last-level cache misses.
+  int64_t cacheMisses;
+
+  /// The number of mispredicted branches.
+  int64_t branchMisses;
+
+  /// The amount of CPU time consumed, in nanoseconds.
+  int64_t taskClockNanoseconds;
+
+  /// The number of page faults.
+  int64_t pageFaults;
+} SWTPerformanceCounterValues;
+
+/// An opaque type representing a set of open performance counters.
+typedef struct SWTPerformanceCounters SWTPerformanceCounters;
+
+/// Open and start a set of performance counters for the current thread.
+///
+/// - Returns: The started counters, or `nullptr` if no performance counters
+///   are available.
+///
+/// On Linux, this function uses `perf_event_open()` to count the hardware
+/// events described by ``SWTPerformanceCounterValues``. Hardware counters are
+/// often unavailable in virtual machines and containers, or when restricted by
+/// the `perf_event_paranoid` setting; if so, only the software counters
+/// (`taskClockNanoseconds` and `pageFaults`) are started. A counter that fails
+/// to open because it is unsupported or not permitted is not retried for the
+/// remainder of the process' lifetime, but one that fails for a transient
+/// reason (such as `EMFILE` or `EBUSY`) is retried by the next call.
+///
+/// On other platforms, this function always returns `nullptr`.
+SWT_EXTERN SWTPerformanceCounters *_Nullable swt_performanceCountersStart(void);
+
+/// Stop and close a set of performance counters.
+///
+/// - Parameters:
+///   - counters: The counters returned by ``swt_performanceCountersStart()``.
+///     After this function returns, `counters` is no longer valid.
+///   - outValues: On return, the values of the counters. If a counter was
+///     multiplexed with other events by the kernel, its value is scaled to
+///     estimate the value it would have had if it had run continuously.
+///
+/// - Returns: Whether or not this function was called on the same thread as
+///   the corresponding call to ``swt_performanceCountersStart()``. If it was
+///   not, the values in `outValues` only describe the original thread.
+SWT_EXTERN bool swt_performanceCountersStop(SWTPerformanceCounters *counters, SWTPerformanceCounterValues *outValues);
+
+SWT_ASSUME_NONNULL_END
+
+#endif
@@ -0,0 +1,65 @@
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for Swift project authors
+//
+
+#if !defined(SWT_PROFILER_H)
+#define SWT_PROFILER_H
+
+#include "Defines.h"
+#include "Includes.h"
+#include "ThreadBacktraces.h"
+
+SWT_ASSUME_NONNULL_BEGIN
+
+/// A function called with the samples collected by the sampling profiler.
+///
+/// - Parameters:
+///   - samples: The backtraces sampled by the profiler, one per sample. This
+///     buffer is only valid for the duration of the call.
+///   - sampleCount: The number of samples in `samples`.
+///   - droppedSampleCount: The number of samples that were taken but could not
+///     be stored because the profiler's sample storage was full.
+///   - context: The value passed as the `context` argument to
+///     ``swt_profilerStop()``.
+typedef void (* SWTProfilerSamplesHandler)(const SWTThreadBacktrace *samples, size_t sampleCount, size_t droppedSampleCount, void *_Nullable context);
+
+/// Start sampling the current process.
+///
+/// - Parameters:
+///   - sampleIntervalMicroseconds: The amount of CPU time consumed by the
+///     process between samples.
+///
+/// - Returns: Whether or not sampling started. If the profiler is already
+///   running, or if it is not supported, this function returns `false`.
+///
+/// On Linux and Android, this function uses `setitimer(ITIMER_PROF)` to
+/// deliver `SIGPROF` to the process each time it consumes
+/// `sampleIntervalMicroseconds` of CPU time. The thread that receives each
+/// signal captures its own backtrace into storage that is allocated ahead of
+/// time. Only one profiling session can be active at a time because the timer
+/// covers every thread in the process. If another signal handler is already
+/// installed for `SIGPROF`, this function returns `false`.
+///
+/// On other platforms, this function always returns `false`.
+SWT_EXTERN bool swt_profilerStart(uint32_t sampleIntervalMicroseconds);
+
+/// Stop sampling the current process.
+///
+/// - Parameters:
+///   - body: A function to call with the samples collected since the
+///     corresponding call to ``swt_profilerStart()``.
+///   - context: An arbitrary pointer to pass to `body`.
+///
+/// This function must only be called after a successful call to
+/// ``swt_profilerStart()``.
+SWT_EXTERN void swt_profilerStop(SWTProfilerSamplesHandler body, void *_Nullable context);
+
+SWT_ASSUME_NONNULL_END
+
+#endif
@@ -0,0 +1,129 @@
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for Swift project authors
+//
+
+#if !defined(SWT_RINGBUFFER_H)
+#define SWT_RINGBUFFER_H
+
+#include "Defines.h"
+#include "Includes.h"
+
+SWT_ASSUME_NONNULL_BEGIN
+
+#if !SWT_NO_FILE_IO && (defined(__APPLE__) || defined(__linux__) || defined(__FreeBSD__) || defined(__ANDROID__))
+/// The header at the start of the memory of a shared-memory ring buffer.
+///
+/// A ring buffer consists of an instance of this structure followed by its
+/// data area, which occupies the remainder of the memory. Memory filled with
+/// zeroes is a valid, empty ring buffer.
+///
+/// Each record in the data area is preceded by its length in bytes as a
+/// `uint32_t` in the host's byte order. Lengths and records are written
+/// contiguously and wrap around from the end of the data area to its start
+/// without padding.
+///
+/// The offset fields of this structure count bytes from the start of the
+/// stream, not from the start of the data area, and only ever increase. The
+/// position of an offset in the data area is the offset modulo the size of
+/// the data area. All fields must be accessed atomically; the offsets are
+/// placed on separate cache lines so that the writer and reader do not contend.
+///
+/// This header is not installed with the testing library, so tools that read
+/// the ring buffer should follow the description of its layout and protocol
+/// in `Documentation/ABI/JSON.md` instead of including it.
+typedef struct SWTRingBufferHeader {
+  /// The offset at which the next record will be written.
+  ///
+  /// The writer stores to this field after a record has been completely
+  /// written. The reader may read up to (but not including) this offset.
+  uint64_t writeOffset;
+  uint8_t _reserved0[56];
+
+  /// The offset at which the reader will next read.
+  ///
+  /// The reader stores to this field after it has finished reading a record,
+  /// which frees the space the record occupied for the writer to reuse.
+  uint64_t readOffset;
+  uint8_t _reserved1[56];
+
+  /// The number of records that were dropped instead of being written.
+  ///
+  /// A record is dropped if it is larger than the data area, if the reader has
+  /// closed the ring buffer, if the reader does not free enough space for it
+  /// within ``SWT_RING_BUFFER_WRITE_TIMEOUT_MILLISECONDS``, or if the reader
+  /// has stalled (see ``isReaderStalled``.)
+  uint64_t droppedRecordCount;
+
+  /// Whether or not the reader has stopped reading records.
+  ///
+  /// The reader stores a non-zero value to this field before it stops reading
+  /// so that the writer drops subsequent records instead of waiting for space
+  /// that will never be freed.
+  uint32_t isReaderClosed;
+
+  /// Whether or not the writer has given up waiting for the reader.
+  ///
+  /// The writer stores a non-zero value to this field when the reader does not
+  /// free enough space for a record within
+  /// ``SWT_RING_BUFFER_WRITE_TIMEOUT_MILLISECONDS``. While it is set and the
+  /// read offset equals ``stalledReadOffset``, the writer drops records
+  /// immediately instead of waiting again. Only the writer uses this field.
+  uint32_t isReaderStalled;
+
+  /// The read offset the writer observed when it set ``isReaderStalled``.
+  ///
+  /// Once the read offset differs from this value, the reader has made
+  /// progress and the writer clears ``isReaderStalled``. Only the writer uses
+  /// this field.
+  uint64_t stalledReadOffset;
+  uint8_t _reserved2[104];
+} SWTRingBufferHeader;
+
+/// How long ``swt_ringBufferWrite()`` waits for the reader of a full ring
+/// buffer to free space before it drops a record, in milliseconds.
+#define SWT_RING_BUFFER_WRITE_TIMEOUT_MILLISECONDS 10000
+
+/// Write a record to a shared-memory ring buffer.
+///
+/// - Parameters:
+///   - buffer: The memory of the ring buffer, starting with its header.
+///   - bufferSize: The size of `buffer` in bytes, including its header.
+///   - notificationFD: A file descriptor to write to when the ring buffer
+///     transitions from empty to non-empty, or `-1` to not notify the reader.
+///     An 8-byte integer with the value `1` is written, so this file descriptor
+///     can be an `eventfd` on Linux or the write end of a pipe.
+///   - record: The record to write.
+///   - recordSize: The size of `record` in bytes.
+///
+/// - Returns: Whether or not the record was written. If it was too large to
+///   ever fit in the ring buffer, or if it was not written for one of the
+///   reasons below, it is dropped and the header's `droppedRecordCount` field
+///   is incremented instead.
+///
+/// If the ring buffer does not have enough free space for `record`, this
+/// function waits for the reader to free some. It stops waiting and drops the
+/// record if the reader sets the header's `isReaderClosed` field or does not
+/// free enough space within ``SWT_RING_BUFFER_WRITE_TIMEOUT_MILLISECONDS``.
+/// Records are also dropped without waiting once `isReaderClosed` is set.
+///
+/// After a timeout, the reader is considered stalled and records are dropped
+/// without waiting until the reader next advances the header's `readOffset`
+/// field, so that a stalled reader delays the writer by at most one timeout
+/// rather than one timeout per record. Otherwise, this function does not
+/// block (other than to notify the reader.)
+///
+/// This function must not be called concurrently for the same ring buffer:
+/// there is exactly one writer. The reader is expected to run concurrently in
+/// another thread or process.
+SWT_EXTERN bool swt_ringBufferWrite(void *buffer, size_t bufferSize, int notificationFD, const void *record, size_t recordSize);
+#endif
+
+SWT_ASSUME_NONNULL_END
+
+#endif
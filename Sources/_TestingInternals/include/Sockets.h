@@ -0,0 +1,62 @@
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for Swift project authors
+//
+
+#if !defined(SWT_SOCKETS_H)
+#define SWT_SOCKETS_H
+
+#include "Defines.h"
+#include "Includes.h"
+
+SWT_ASSUME_NONNULL_BEGIN
+
+#if !SWT_NO_FILE_IO && (defined(__APPLE__) || defined(__linux__) || defined(__FreeBSD__) || defined(__ANDROID__))
+/// Create a Unix domain stream socket bound to a path and listen on it.
+///
+/// - Parameters:
+///   - path: The path to bind the socket to. If a file already exists at this
+///     path, this function fails with `EADDRINUSE`.
+///
+/// - Returns: A file descriptor for the listening socket, or `-1` if an error
+///   occurred, in which case `errno` is set. If `path` is too long to fit in a
+///   `sockaddr_un` structure, `errno` is set to `ENAMETOOLONG`.
+///
+/// This function is provided because `sockaddr_un` and the socket type
+/// constants are imported into Swift inconsistently across platforms.
+SWT_EXTERN int swt_unixDomainSocketListen(const char *path);
+
+/// Accept a connection on a listening Unix domain socket.
+///
+/// - Parameters:
+///   - fd: A file descriptor returned by ``swt_unixDomainSocketListen()``.
+///
+/// - Returns: A file descriptor for the accepted connection, or `-1` if an
+///   error occurred, in which case `errno` is set.
+///
+/// Where supported, the accepted connection is configured to fail writes with
+/// `EPIPE` rather than raising `SIGPIPE` after the peer disconnects.
+SWT_EXTERN int swt_unixDomainSocketAccept(int fd);
+
+/// Connect to a Unix domain stream socket that is listening at a path.
+///
+/// - Parameters:
+///   - path: The path the listening socket is bound to.
+///
+/// - Returns: A file descriptor for the connection, or `-1` if an error
+///   occurred, in which case `errno` is set. If `path` is too long to fit in a
+///   `sockaddr_un` structure, `errno` is set to `ENAMETOOLONG`.
+///
+/// Where supported, the connection is configured to fail writes with `EPIPE`
+/// rather than raising `SIGPIPE` after the peer disconnects.
+SWT_EXTERN int swt_unixDomainSocketConnect(const char *path);
+#endif
+
+SWT_ASSUME_NONNULL_END
+
+#endif
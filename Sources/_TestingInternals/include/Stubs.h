@@ -62,6 +62,17 @@ static bool swt_S_ISFIFO(mode_t mode) {
   return S_ISFIFO(mode);
 }
 #endif
+
+#if __has_include(<sys/stat.h>) && defined(S_ISREG)
+/// Check if a given `mode_t` value indicates that a file is a regular file.
+///
+/// This function is exactly equivalent to the `S_ISREG()` macro. It is
+/// necessary because the mode flag macros are not imported into Swift
+/// consistently across platforms.
+static bool swt_S_ISREG(mode_t mode) {
+  return S_ISREG(mode);
+}
+#endif
 #endif
 
 #if defined(__APPLE__) && !SWT_NO_MACH_PORTS
@@ -116,6 +127,18 @@ static char *_Nullable *_Null_unspecified swt_environ(void) {
 /// only declared if `_GNU_SOURCE` is set, but setting it causes build errors
 /// due to conflicts with Swift's Glibc module.
 SWT_EXTERN int swt_pthread_setname_np(pthread_t thread, const char *name);
+
+/// Initialize a mutex that spins briefly before sleeping when contended.
+///
+/// On glibc, this function initializes `mutex` with the
+/// `PTHREAD_MUTEX_ADAPTIVE_NP` type, which spins in user space for a bounded
+/// number of iterations before falling back to a `futex()` wait. Short critical
+/// sections under contention then rarely enter the kernel. On other C standard
+/// libraries, this function is equivalent to `pthread_mutex_init(mutex, NULL)`.
+///
+/// This function declaration is provided because `PTHREAD_MUTEX_ADAPTIVE_NP` is
+/// only declared if `_GNU_SOURCE` is set.
+SWT_EXTERN int swt_pthread_mutex_init_adaptive_np(pthread_mutex_t *mutex);
 #endif
 
 #if defined(__GLIBC__)
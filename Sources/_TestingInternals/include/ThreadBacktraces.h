@@ -0,0 +1,67 @@
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for Swift project authors
+//
+
+#if !defined(SWT_THREADBACKTRACES_H)
+#define SWT_THREADBACKTRACES_H
+
+#include "Defines.h"
+#include "Includes.h"
+
+SWT_ASSUME_NONNULL_BEGIN
+
+/// A structure describing the backtrace of a thread captured by
+/// ``swt_withAllThreadBacktraces()``.
+typedef struct SWTThreadBacktrace {
+  /// The operating system's identifier for the thread.
+  uint64_t threadID;
+
+  /// The addresses in the backtrace, starting with the most recent frame.
+  const void *_Nullable const *addresses;
+
+  /// The number of addresses in `addresses`.
+  size_t addressCount;
+} SWTThreadBacktrace;
+
+/// A function called with the backtraces captured by
+/// ``swt_withAllThreadBacktraces()``.
+///
+/// - Parameters:
+///   - backtraces: The captured backtraces. This buffer is only valid for the
+///     duration of the call.
+///   - backtraceCount: The number of backtraces in `backtraces`.
+///   - context: The value passed as the `context` argument to
+///     ``swt_withAllThreadBacktraces()``.
+typedef void (* SWTThreadBacktracesHandler)(const SWTThreadBacktrace *backtraces, size_t backtraceCount, void *_Nullable context);
+
+/// Capture the backtraces of every other thread in the current process.
+///
+/// - Parameters:
+///   - timeoutMilliseconds: How long to wait for threads to capture their
+///     backtraces.
+///   - body: A function to call with the captured backtraces.
+///   - context: An arbitrary pointer to pass to `body`.
+///
+/// - Returns: Whether or not backtraces could be captured. If `false`, `body`
+///   is not called.
+///
+/// On Linux and Android, this function sends a real-time signal to each other
+/// thread in the process. Each thread captures its own backtrace from within
+/// the signal handler into storage that is allocated ahead of time, so that
+/// threads that are blocked or deadlocked can still be inspected. Threads that
+/// block the signal, or that do not respond before `timeoutMilliseconds` has
+/// elapsed, are omitted. If another signal handler is already installed for
+/// the signal, this function returns `false`.
+///
+/// On other platforms, this function always returns `false`.
+SWT_EXTERN bool swt_withAllThreadBacktraces(uint32_t timeoutMilliseconds, SWTThreadBacktracesHandler body, void *_Nullable context);
+
+SWT_ASSUME_NONNULL_END
+
+#endif
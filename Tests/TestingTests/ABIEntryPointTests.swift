@@ -154,6 +154,66 @@ struct ABIEntryPointTests {
     return try await abiEntryPoint(.init(argumentsJSON), recordHandler)
   }
 
+#if !SWT_NO_FILE_IO && (SWT_TARGET_OS_APPLE || os(Linux) || os(FreeBSD) || os(Android))
+  @Test("v0 ring buffer entry point")
+  func v0_ringBuffer() async throws {
+    var arguments = __CommandLineArguments_v0()
+    arguments.filter = ["NonExistentTestThatMatchesNothingHopefully"]
+    arguments.eventStreamVersion = 0
+    arguments.verbosity = .min
+    let argumentsJSON = try JSON.withEncoding(of: arguments) { argumentsJSON in
+      let result = UnsafeMutableRawBufferPointer.allocate(byteCount: argumentsJSON.count, alignment: 1)
+      result.copyMemory(from: argumentsJSON)
+      return result
+    }
+    defer {
+      argumentsJSON.deallocate()
+    }
+
+    // Use a ring buffer large enough to hold every record so that this test
+    // does not need to drain it concurrently.
+    let ringBuffer = UnsafeMutableRawBufferPointer.allocate(byteCount: 1024 * 1024, alignment: 64)
+    ringBuffer.initializeMemory(as: UInt8.self, repeating: 0)
+    defer {
+      ringBuffer.deallocate()
+    }
+    let abiEntryPoint = unsafeBitCast(abiv0_getRingBufferEntryPoint(), to: ABIv0.RingBufferEntryPoint.self)
+    let result = try await abiEntryPoint(.init(argumentsJSON), ringBuffer, -1)
+    #expect(result)
+
+    // Read the records back out of the ring buffer.
+    let header = ringBuffer.load(as: SWTRingBufferHeader.self)
+    #expect(header.droppedRecordCount == 0)
+    let data = UnsafeRawBufferPointer(rebasing: ringBuffer[MemoryLayout<SWTRingBufferHeader>.size...])
+    var offset = Int(header.readOffset)
+    var eventKinds = [ABIv0.EncodedEvent.Kind]()
+    while offset < Int(header.writeOffset) {
+      let length = Int(data.loadUnaligned(fromByteOffset: offset, as: UInt32.self))
+      let recordJSON = UnsafeRawBufferPointer(rebasing: data[(offset + 4) ..< (offset + 4 + length)])
+      let record = try JSON.decode(ABIv0.Record.self, from: recordJSON)
+      if case let .event(event) = record.kind {
+        eventKinds.append(event.kind)
+      }
+      offset += 4 + length
+    }
+    #expect(eventKinds.contains(.runStarted))
+    #expect(eventKinds.last == .runEnded)
+  }
+#endif
+
+  @Test("Experimental event kinds are not encoded in the v0 event stream", arguments: [
+    Event.Kind.benchmarkEnded(BenchmarkTrait.Statistics(durations: [1, 2, 3])),
+    Event.Kind.performanceCountersMeasured(PerformanceCounters(instructions: 1_000)),
+    Event.Kind.startupMeasured(StartupProfile()),
+    Event.Kind.flakeHuntEnded(FlakeHuntingPolicy.Result(attemptCount: 10, failureCount: 1)),
+    Event.Kind.testCaseProfiled(SamplingProfile(sampleCounts: [:], droppedSampleCount: 0)),
+  ])
+  func experimentalEventKindsNotEncoded(kind: Event.Kind) {
+    let event = Event(kind, testID: nil, testCaseID: nil)
+    let eventContext = Event.Context(test: nil, testCase: nil, configuration: nil)
+    #expect(ABIv0.EncodedEvent(encoding: event, in: eventContext, messages: []) == nil)
+  }
+
 #if canImport(Foundation)
   @Test func decodeEmptyConfiguration() throws {
     let emptyBuffer = UnsafeRawBufferPointer(start: nil, count: 0)
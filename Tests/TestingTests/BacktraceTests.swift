@@ -136,6 +136,19 @@ struct BacktraceTests {
     #expect(!backtrace.addresses.isEmpty)
   }
 
+  @Test("Backtrace.allOtherThreads() is populated")
+  func allOtherThreadsBacktraces() throws {
+#if os(Linux) || os(Android)
+    let backtraces = try #require(Backtrace.allOtherThreads())
+    #expect(!backtraces.isEmpty)
+    for backtrace in backtraces {
+      #expect(!backtrace.addresses.isEmpty)
+    }
+#else
+    #expect(Backtrace.allOtherThreads() == nil)
+#endif
+  }
+
   @Test("An unthrown error has no backtrace")
   func noBacktraceForNewError() throws {
     #expect(Backtrace(forFirstThrowOf: BacktracedError()) == nil)
@@ -121,6 +121,30 @@ struct ClockTests {
     #expect(duration == .nanoseconds(offsetNanoseconds))
   }
 
+#if !SWT_NO_UTC_CLOCK && !SWT_NO_TIMESPEC
+  @Test("Clock.Instant.wall is derived from the suspending clock")
+  func wallIsDerived() {
+    var wall = timespec()
+    timespec_get(&wall, TIME_UTC)
+    let instant = Test.Clock.Instant.now
+
+    let difference = Double(instant.wall) - Double(TimeValue(wall))
+    #expect(abs(difference) < 1.0)
+  }
+#endif
+
+  @Test("TimeValue.advanced(byNanoseconds:) method",
+    arguments: [
+      (TimeValue((1, 0)), Int64(1), TimeValue((1, 1_000_000_000))),
+      (TimeValue((1, 0)), -1, TimeValue((0, 999_999_999_000_000_000))),
+      (TimeValue((1, 999_999_999_000_000_000)), 1, TimeValue((2, 0))),
+      (TimeValue((1, 0)), -1_500_000_000, TimeValue((-1, 500_000_000_000_000_000))),
+    ]
+  )
+  func timeValueAdvancedByNanoseconds(timeValue: TimeValue, nanoseconds: Int64, expected: TimeValue) {
+    #expect(timeValue.advanced(byNanoseconds: nanoseconds) == expected)
+  }
+
 #if canImport(Foundation)
   @available(_clockAPI, *)
   @Test("Codable")
@@ -130,6 +154,11 @@ struct ClockTests {
     let decoded = try JSON.encodeAndDecode(instant)
     #expect(instant == decoded)
     #expect(instant != now)
+#if !SWT_NO_UTC_CLOCK
+    // The decoded instant preserves the wall-clock time it was encoded with.
+    let redecoded = try JSON.encodeAndDecode(decoded)
+    #expect(decoded.wall == redecoded.wall)
+#endif
   }
 #endif
 
@@ -0,0 +1,97 @@
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for Swift project authors
+//
+
+@testable @_spi(Experimental) import Testing
+
+@Suite("Covering array Tests")
+struct CoveringArrayTests {
+  /// Check that every combination of values of every `strength` parameters
+  /// appears in a covering array.
+  func isCovering(_ coveringArray: CoveringArray, valueCounts: [Int], strength: Int) -> Bool {
+    let strength = min(strength, valueCounts.count)
+    func combinations(of size: Int, from range: Range<Int>) -> [[Int]] {
+      if size == 0 {
+        return [[]]
+      }
+      return range.flatMap { first in
+        combinations(of: size - 1, from: (first + 1) ..< range.upperBound).map { [first] + $0 }
+      }
+    }
+    return combinations(of: strength, from: valueCounts.indices).allSatisfy { parameters in
+      let covered = Set(coveringArray.rows.map { row in parameters.map { row[$0] } })
+      let expectedCount = parameters.reduce(1) { $0 * valueCounts[$1] }
+      return covered.count == expectedCount
+    }
+  }
+
+  @Test("Covering arrays cover every combination", arguments: [
+    ([3, 3, 3], 2),
+    ([3, 3, 3, 3], 2),
+    ([2, 5, 1, 4, 3], 2),
+    ([10, 10, 10, 10, 10], 2),
+    ([4, 4, 4, 4, 4], 3),
+    ([2, 3, 4], 3),
+    ([2, 3, 4], 1),
+  ])
+  func covering(valueCounts: [Int], strength: Int) {
+    let coveringArray = CoveringArray(valueCounts: valueCounts, strength: strength, seed: 0)
+    #expect(isCovering(coveringArray, valueCounts: valueCounts, strength: strength))
+    #expect(coveringArray.rows.allSatisfy { $0.count == valueCounts.count })
+  }
+
+  @Test("Pairwise covering arrays are much smaller than the Cartesian product")
+  func size() {
+    let valueCounts = [10, 10, 10, 10, 10]
+    let coveringArray = CoveringArray(valueCounts: valueCounts, strength: 2, seed: 0)
+    #expect(isCovering(coveringArray, valueCounts: valueCounts, strength: 2))
+    #expect(coveringArray.rows.count < 200)
+  }
+
+  @Test("Full-strength covering arrays are Cartesian products")
+  func fullStrength() {
+    let coveringArray = CoveringArray(valueCounts: [2, 3, 4], strength: 5, seed: 0)
+    #expect(coveringArray.rows.count == 24)
+    #expect(Set(coveringArray.rows).count == 24)
+  }
+
+  @Test("Covering arrays with an empty parameter are empty")
+  func emptyParameter() {
+    #expect(CoveringArray(valueCounts: [3, 0, 3], strength: 2, seed: 0).rows.isEmpty)
+    #expect(pairwise(1 ... 3, [Int](), "abc").isEmpty)
+  }
+
+  @Test("Covering arrays are deterministic")
+  func determinism() {
+    let rows1 = CoveringArray(valueCounts: [4, 5, 6, 7], strength: 2, seed: 12345).rows
+    let rows2 = CoveringArray(valueCounts: [4, 5, 6, 7], strength: 2, seed: 12345).rows
+    #expect(rows1 == rows2)
+  }
+
+  @Test("pairwise() passes every pair of arguments to a test")
+  func pairwiseTest() async {
+    let pairs = Locked(rawValue: Set<String>())
+    await confirmation("test case started", expectedCount: 9 ..< 18) { testCaseStarted in
+      await Test(arguments: pairwise(["a", "b", "c"], 0 ..< 3, [true, false])) { string, int, bool in
+        testCaseStarted()
+        pairs.withLock { pairs in
+          pairs.insert("\(string)\(int)")
+          pairs.insert("\(string)\(bool)")
+          pairs.insert("\(int)\(bool)")
+        }
+      }.run()
+    }
+    #expect(pairs.rawValue.count == 21)
+  }
+
+  @Test("nWise() can cover triples", arguments: nWise(3, 0 ..< 2, 0 ..< 2, 0 ..< 2, 0 ..< 2))
+  func nWiseTest(a: Int, b: Int, c: Int, d: Int) {
+    #expect([a, b, c, d].allSatisfy { (0 ..< 2).contains($0) })
+  }
+}
@@ -31,6 +31,14 @@ struct EventRecorderTests {
         $0.append(string)
       }
     }
+
+    @Sendable func rewrite(_ string: String, atOffset offset: Int) {
+      buffer.withLock { buffer in
+        var bytes = Array(buffer.utf8)
+        bytes.replaceSubrange(offset ..< offset + string.utf8.count, with: string.utf8)
+        buffer = String(decoding: bytes, as: UTF8.self)
+      }
+    }
   }
 
   private static var optionCombinations: [(useSFSymbols: Bool, ansiColorBitDepth: Int8?)] {
@@ -93,6 +101,35 @@ struct EventRecorderTests {
     }
   }
 
+  @Test("Live progress output", arguments: [false, true])
+  func liveProgressOutput(useANSIEscapeCodes: Bool) async throws {
+    let stream = Stream()
+
+    var options = Event.ConsoleOutputRecorder.Options()
+    options.useANSIEscapeCodes = useANSIEscapeCodes
+    options.showsLiveProgress = true
+
+    var configuration = Configuration()
+    let eventRecorder = Event.ConsoleOutputRecorder(options: options, writingUsing: stream.write)
+    configuration.eventHandler = { event, context in
+      eventRecorder.record(event, in: context)
+    }
+
+    await runTest(for: WrittenTests.self, configuration: configuration)
+
+    let buffer = stream.buffer.rawValue
+    #expect(buffer.contains("Whales fail."))
+    #expect(buffer.contains("Ocelots don't like the number 3."))
+    #expect(buffer.contains(" finished, "))
+    #expect(!buffer.contains("Test failWhale() started."))
+    #expect(buffer.hasSuffix("\n"))
+    #expect(buffer.contains("\r\u{001B}[2K") == useANSIEscapeCodes)
+
+    if testsWithSignificantIOAreEnabled {
+      print(buffer, terminator: "")
+    }
+  }
+
   @Test("Verbose output")
   func verboseOutput() async throws {
     let stream = Stream()
@@ -302,14 +339,19 @@ struct EventRecorderTests {
 #if canImport(Foundation) || canImport(FoundationXML)
   @Test(
     "JUnitXMLRecorder outputs valid XML",
-    .bug("https://github.com/swiftlang/swift-testing/issues/254")
+    .bug("https://github.com/swiftlang/swift-testing/issues/254"),
+    arguments: [false, true]
   )
-  func junitXMLIsValid() async throws {
+  func junitXMLIsValid(streaming: Bool) async throws {
     let stream = Stream()
 
     var configuration = Configuration()
     configuration.deliverExpectationCheckedEvents = true
-    let eventRecorder = Event.JUnitXMLRecorder(writingUsing: stream.write)
+    let eventRecorder = if streaming {
+      Event.JUnitXMLRecorder(writingUsing: stream.write, rewritingUsing: stream.rewrite)
+    } else {
+      Event.JUnitXMLRecorder(writingUsing: stream.write)
+    }
     configuration.eventHandler = { event, context in
       eventRecorder.record(event, in: context)
     }
@@ -376,6 +418,92 @@ struct EventRecorderTests {
     #expect(!testCaseLines.isEmpty)
     #expect(!testCaseLines.contains { $0.contains("time=") })
   }
+
+  @Test("Streaming JUnitXMLRecorder writes each test when it ends")
+  func junitXMLStreaming() async throws {
+    let stream = Stream()
+
+    let eventRecorder = Event.JUnitXMLRecorder(writingUsing: stream.write, rewritingUsing: stream.rewrite)
+    let context = Event.Context(test: nil, testCase: nil, configuration: nil)
+    eventRecorder.record(Event(.runStarted, testID: nil, testCaseID: nil), in: context)
+
+    let test = Test {}
+    let testContext = Event.Context(test: test, testCase: nil, configuration: nil)
+    eventRecorder.record(Event(.testStarted, testID: test.id, testCaseID: nil), in: testContext)
+    eventRecorder.record(Event(.issueRecorded(Issue(kind: .unconditional)), testID: test.id, testCaseID: nil), in: testContext)
+    #expect(!stream.buffer.rawValue.contains("<testcase"))
+    eventRecorder.record(Event(.testEnded, testID: test.id, testCaseID: nil), in: testContext)
+    #expect(stream.buffer.rawValue.contains("<testcase"))
+    #expect(stream.buffer.rawValue.contains("<failure"))
+
+    eventRecorder.record(Event(.runEnded, testID: nil, testCaseID: nil), in: context)
+    let xmlString = stream.buffer.rawValue
+    #expect(xmlString.hasSuffix("</testsuites>\n"))
+
+    // The <testsuite> start tag was replaced in place with the final counts.
+    let startTag = try #require(xmlString.split(whereSeparator: \.isNewline).first { $0.contains("<testsuite ") })
+    #expect(startTag.contains(#"tests="1""#))
+    #expect(startTag.contains(#"failures="1""#))
+    #expect(startTag.hasSuffix(">"))
+    #expect(xmlString.hasPrefix("<?xml"))
+  }
+
+  @Test("Streaming and buffered JUnitXMLRecorder report the same counts")
+  func junitXMLStreamingAndBufferedCountsMatch() throws {
+    let bufferedStream = Stream()
+    let streamingStream = Stream()
+    let recorders = [
+      Event.JUnitXMLRecorder(writingUsing: bufferedStream.write),
+      Event.JUnitXMLRecorder(writingUsing: streamingStream.write, rewritingUsing: streamingStream.rewrite),
+    ]
+    func record(_ kind: Event.Kind, for test: Test? = nil) {
+      let event = Event(kind, testID: test?.id, testCaseID: nil)
+      let context = Event.Context(test: test, testCase: nil, configuration: nil)
+      for recorder in recorders {
+        recorder.record(event, in: context)
+      }
+    }
+    let issue = Event.Kind.issueRecorded(Issue(kind: .unconditional))
+
+    record(.runStarted)
+
+    // An issue recorded while the test runs and another recorded after it ends.
+    let failingTest = Test(name: "failingTest") {}
+    record(.testStarted, for: failingTest)
+    record(issue, for: failingTest)
+    record(.testEnded, for: failingTest)
+    record(issue, for: failingTest)
+
+    // An issue recorded for a test that never started.
+    record(issue, for: Test(name: "unstartedTest") {})
+
+    // An issue recorded for no test.
+    record(issue)
+
+    // A flaky test, whose issues do not count, and a consistently failing one.
+    let flakyTest = Test(name: "flakyTest") {}
+    let consistentlyFailingTest = Test(name: "consistentlyFailingTest") {}
+    for test in [flakyTest, consistentlyFailingTest] {
+      record(.testStarted, for: test)
+      record(issue, for: test)
+      record(.testEnded, for: test)
+    }
+    record(.testCaseRetried(.init(verdict: .flaky, retryCount: 1)), for: flakyTest)
+    record(.testCaseRetried(.init(verdict: .consistentlyFailing, retryCount: 1, failureDescriptions: ["Issue recorded"])), for: consistentlyFailingTest)
+
+    record(.testSkipped(.init(sourceContext: .init())), for: Test(name: "skippedTest") {})
+    record(.runEnded)
+
+    func startTag(in xmlString: String) throws -> Substring {
+      try #require(xmlString.split(whereSeparator: \.isNewline).first { $0.contains("<testsuite ") })
+    }
+    let bufferedStartTag = try startTag(in: bufferedStream.buffer.rawValue)
+    let streamingStartTag = try startTag(in: streamingStream.buffer.rawValue)
+    for attribute in [#"tests="3""#, #"failures="5""#, #"skipped="1""#] {
+      #expect(bufferedStartTag.contains(attribute))
+      #expect(streamingStartTag.contains(attribute))
+    }
+  }
 #endif
 
   @Test("HumanReadableOutputRecorder counts issues without associated tests")
@@ -0,0 +1,116 @@
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for Swift project authors
+//
+
+@testable @_spi(Experimental) @_spi(ForToolsIntegrationOnly) import Testing
+
+@Suite("Flake Hunting Policy Tests")
+struct FlakeHuntingPolicyTests {
+  @Test("Confidence interval of the failure rate")
+  func confidenceInterval() {
+    let noFailures = FlakeHuntingPolicy.Result(attemptCount: 1_000, failureCount: 0)
+    #expect(noFailures.failureRate == 0)
+    #expect(noFailures.failureRateConfidenceInterval.lowerBound == 0)
+    #expect(noFailures.failureRateConfidenceInterval.upperBound > 0.003 && noFailures.failureRateConfidenceInterval.upperBound < 0.004)
+
+    let halfFailures = FlakeHuntingPolicy.Result(attemptCount: 100, failureCount: 50)
+    #expect(halfFailures.failureRate == 0.5)
+    #expect(halfFailures.failureRateConfidenceInterval.lowerBound > 0.40 && halfFailures.failureRateConfidenceInterval.lowerBound < 0.41)
+    #expect(halfFailures.failureRateConfidenceInterval.upperBound > 0.59 && halfFailures.failureRateConfidenceInterval.upperBound < 0.60)
+
+    #expect(FlakeHuntingPolicy.Result().failureRateConfidenceInterval == 0 ... 1)
+  }
+
+  @Test("Policy stops when its threshold is decided")
+  func shouldStop() {
+    var policy = FlakeHuntingPolicy(maximumAttemptCount: 10_000, stopsAtFirstFailure: false, failureRateThreshold: 0.01)
+    #expect(!policy.shouldStop(after: .init(attemptCount: 10, failureCount: 0)))
+    #expect(policy.shouldStop(after: .init(attemptCount: 1_000, failureCount: 0)))
+    #expect(policy.shouldStop(after: .init(attemptCount: 100, failureCount: 20)))
+    #expect(!policy.shouldStop(after: .init(attemptCount: 100, failureCount: 1)))
+
+    policy.stopsAtFirstFailure = true
+    #expect(policy.shouldStop(after: .init(attemptCount: 1, failureCount: 1)))
+  }
+
+  @Test("Each test case is attempted until it fails", arguments: [1, 4])
+  func stopsAtFirstFailure(maximumConcurrentAttemptCount: Int) async throws {
+    let attemptCount = Locked(rawValue: 0)
+    let results = Locked<[FlakeHuntingPolicy.Result]>(rawValue: [])
+    var configuration = Configuration()
+    configuration.flakeHuntingPolicy = FlakeHuntingPolicy(maximumAttemptCount: 100, maximumConcurrentAttemptCount: maximumConcurrentAttemptCount)
+    configuration.eventHandler = { event, _ in
+      if case let .flakeHuntEnded(result) = event.kind {
+        results.withLock { results in
+          results.append(result)
+        }
+      }
+    }
+    await Test {
+      let attemptIndex = attemptCount.withLock { attemptCount in
+        defer {
+          attemptCount += 1
+        }
+        return attemptCount
+      }
+      #expect(attemptIndex < 10)
+    }.run(configuration: configuration)
+
+    #expect(results.rawValue.count == 1)
+    let result = try #require(results.rawValue.first)
+    #expect(result.failureCount >= 1)
+    #expect(result.attemptCount == attemptCount.rawValue)
+    #expect(attemptCount.rawValue >= 11 && attemptCount.rawValue <= 10 + maximumConcurrentAttemptCount)
+  }
+
+  @Test("Passing test cases are attempted the maximum number of times")
+  func attemptsPassingTestCases() async {
+    let results = Locked<[FlakeHuntingPolicy.Result]>(rawValue: [])
+    var configuration = Configuration()
+    configuration.flakeHuntingPolicy = FlakeHuntingPolicy(maximumAttemptCount: 20)
+    configuration.eventHandler = { event, _ in
+      if case let .flakeHuntEnded(result) = event.kind {
+        #expect(event.testCaseID != nil)
+        results.withLock { results in
+          results.append(result)
+        }
+      }
+    }
+    await Test(arguments: 0 ..< 3) { _ in }.run(configuration: configuration)
+
+    #expect(results.rawValue == Array(repeating: .init(attemptCount: 20, failureCount: 0), count: 3))
+  }
+
+  @Test("Known issues do not count as failures")
+  func knownIssues() async {
+    let results = Locked<[FlakeHuntingPolicy.Result]>(rawValue: [])
+    var configuration = Configuration()
+    configuration.flakeHuntingPolicy = FlakeHuntingPolicy(maximumAttemptCount: 5)
+    configuration.eventHandler = { event, _ in
+      if case let .flakeHuntEnded(result) = event.kind {
+        results.withLock { results in
+          results.append(result)
+        }
+      }
+    }
+    await Test {
+      withKnownIssue {
+        Issue.record()
+      }
+    }.run(configuration: configuration)
+
+    #expect(results.rawValue == [.init(attemptCount: 5, failureCount: 0)])
+  }
+
+  @Test("Result summary")
+  func summary() {
+    let result = FlakeHuntingPolicy.Result(attemptCount: 100, failureCount: 50)
+    #expect(result.summary == "failed 50 of 100 attempts (50.00%, 95% confidence interval 40.38%–59.62%)")
+  }
+}
@@ -317,6 +317,35 @@ final class IssueTests: XCTestCase {
     await fulfillment(of: [expectationChecked], timeout: 0.0)
   }
 
+  func testThrownErrorLazyReflection() async {
+    struct DelicateError: Error, CustomStringConvertible {
+      var description: String {
+        XCTFail("Should not be called")
+        return "danger"
+      }
+    }
+
+    let expectationChecked = expectation(description: "expectation checked")
+
+    var configuration = Configuration()
+    configuration.deliverExpectationCheckedEvents = true
+    configuration.eventHandler = { event, _ in
+      guard case let .expectationChecked(expectation) = event.kind else {
+        return
+      }
+      XCTAssertTrue(expectation.isPassing)
+      XCTAssertNil(expectation.evaluatedExpression.runtimeValue)
+      expectationChecked.fulfill()
+    }
+
+    await Test {
+      #expect(throws: DelicateError.self) {
+        throw DelicateError()
+      }
+    }.run(configuration: configuration)
+    await fulfillment(of: [expectationChecked], timeout: 0.0)
+  }
+
   func testExpressionLiterals() async {
     func expectIssue(containing content: String, in testFunction: @escaping @Sendable () async throws -> Void) async {
       let issueRecorded = expectation(description: "Issue recorded")
@@ -1460,6 +1489,8 @@ struct IssueCodingTests {
     Issue.Kind.knownIssueNotRecorded,
     Issue.Kind.system,
     Issue.Kind.timeLimitExceeded(timeLimitComponents: (13, 42)),
+    Issue.Kind.performanceRegressed(PerformanceBaselines.Regression(nanoseconds: 2_000_000, baselineMedianNanoseconds: 1_000_000, baselineSampleCount: 5, score: 4.5)),
+    Issue.Kind.allocationBudgetExceeded(Event.AllocationCounts(allocationCount: 3, allocatedByteCount: 96), budget: .allocationBudget(allocations: 1, bytes: 64)),
     Issue.Kind.unconditional,
   ]
 
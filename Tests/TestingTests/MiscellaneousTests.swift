@@ -569,4 +569,16 @@ struct MiscellaneousTests {
     }
     #expect(duration < .seconds(1))
   }
+
+  @available(_clockAPI, *)
+  @Test("Repeated calls to #expect() with binary operators run in reasonable time", .disabled("time-sensitive"))
+  func repeatedlyExpectBinaryOperation() {
+    let duration = Test.Clock().measure {
+      for i in 0 ..< 1_000_000 {
+        #expect(i == i)
+        #expect(i < i + 1)
+      }
+    }
+    #expect(duration < .seconds(1))
+  }
 }
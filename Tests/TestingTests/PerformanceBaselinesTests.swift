@@ -0,0 +1,145 @@
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for Swift project authors
+//
+
+@testable @_spi(Experimental) @_spi(ForToolsIntegrationOnly) import Testing
+
+@Suite("Performance Baseline Tests")
+struct PerformanceBaselinesTests {
+  /// Baseline samples of about 100 milliseconds with a little noise.
+  let samples: [Int64] = [98, 99, 100, 100, 101, 102].map { $0 * 1_000_000 }
+
+  @Test("Slow measurements are regressions", arguments: [
+    PerformanceBaselines.RegressionPolicy.StatisticalTest.medianAbsoluteDeviation,
+    .zScore,
+  ])
+  func regression(statisticalTest: PerformanceBaselines.RegressionPolicy.StatisticalTest) throws {
+    var policy = PerformanceBaselines.RegressionPolicy()
+    policy.statisticalTest = statisticalTest
+
+    let regression = try #require(PerformanceBaselines.regression(of: 200_000_000, against: samples, policy: policy))
+    #expect(regression.nanoseconds == 200_000_000)
+    #expect(regression.baselineMedianNanoseconds == 100_000_000)
+    #expect(regression.baselineSampleCount == samples.count)
+    #expect(regression.score > policy.threshold)
+
+    #expect(PerformanceBaselines.regression(of: 101_000_000, against: samples, policy: policy) == nil)
+    #expect(PerformanceBaselines.regression(of: 50_000_000, against: samples, policy: policy) == nil)
+  }
+
+  @Test("Small increases are not regressions")
+  func minimumIncrease() {
+    var policy = PerformanceBaselines.RegressionPolicy()
+    policy.threshold = 0
+
+    // Statistically significant, but less than the minimum relative increase.
+    #expect(PerformanceBaselines.regression(of: 105_000_000, against: samples, policy: policy) == nil)
+
+    // Statistically significant, but less than the minimum absolute increase.
+    let fastSamples: [Int64] = [1_000, 1_000, 1_000]
+    #expect(PerformanceBaselines.regression(of: 10_000, against: fastSamples, policy: policy) == nil)
+  }
+
+  @Test("Baselines with too few samples are not compared against")
+  func minimumSampleCount() {
+    let policy = PerformanceBaselines.RegressionPolicy()
+    #expect(PerformanceBaselines.regression(of: 1_000_000_000, against: Array(samples.prefix(2)), policy: policy) == nil)
+  }
+
+  @Test("Keys of parameterized test cases are distinct")
+  func keys() throws {
+    let test = Test(arguments: [1, 2]) { _ in }
+    let testCases = Array(try #require(test.testCases))
+    let keys = testCases.compactMap { PerformanceBaselines.key(for: test, testCase: $0) }
+    #expect(keys.count == 2)
+    #expect(Set(keys).count == 2)
+  }
+
+  @Test("Updating baselines never reports regressions")
+  func update() {
+    let baselines = PerformanceBaselines(isUpdating: true)
+    for nanoseconds in [1, 1, 1, 1_000_000_000] as [Int64] {
+      #expect(baselines.record(nanoseconds, forKey: "key") == nil)
+    }
+  }
+
+  @Test("Measurements are only compared against baselines of the same host")
+  func hostFingerprint() {
+    let baselines = PerformanceBaselines(isUpdating: true, hostFingerprint: "host")
+    #expect(baselines.hostFingerprint == "host")
+    #expect(PerformanceBaselines(isUpdating: true).hostFingerprint == PerformanceBaselines.currentHostFingerprint)
+  }
+
+#if canImport(Foundation) && !SWT_NO_FILE_IO
+  /// Write a baseline to a file and read it back.
+  ///
+  /// - Parameters:
+  ///   - samples: The samples to write.
+  ///   - key: The key under which to write `samples`.
+  ///   - hostFingerprint: The host fingerprint under which to write `samples`.
+  ///   - policy: The regression policy of the resulting instance.
+  ///
+  /// - Returns: An instance that was read from the written file.
+  func roundTrip(_ samples: [Int64], forKey key: String, hostFingerprint: String? = nil, policy: PerformanceBaselines.RegressionPolicy = .init()) throws -> PerformanceBaselines {
+    try withTemporaryPath { path in
+      let updatingBaselines = PerformanceBaselines(isUpdating: true, hostFingerprint: hostFingerprint)
+      for sample in samples {
+        _ = updatingBaselines.record(sample, forKey: key)
+      }
+      try updatingBaselines.write(toFileAtPath: path)
+      return try PerformanceBaselines(contentsOfFileAtPath: path, regressionPolicy: policy)
+    }
+  }
+
+  @Test("Baselines round-trip through a file")
+  func fileRoundTrip() throws {
+    let baselines = try roundTrip(samples, forKey: "key")
+    #expect(baselines.record(200_000_000, forKey: "key") != nil)
+    #expect(baselines.record(100_000_000, forKey: "key") == nil)
+    #expect(baselines.record(200_000_000, forKey: "other key") == nil)
+  }
+
+  @Test("Baselines of other hosts are ignored")
+  func otherHost() throws {
+    let baselines = try roundTrip(samples, forKey: "key", hostFingerprint: "some other host")
+    #expect(baselines.record(200_000_000, forKey: "key") == nil)
+  }
+
+  @Test("Reading baselines from a missing file")
+  func missingFile() throws {
+    let baselines = try withTemporaryPath { path in
+      try PerformanceBaselines(contentsOfFileAtPath: path)
+    }
+    #expect(baselines.record(1_000_000_000, forKey: "key") == nil)
+  }
+
+  @Test("Runner records an issue when a test case regresses")
+  func runnerRecordsRegression() async throws {
+    let test = Test {}
+    let testCase = try #require(test.testCases?.first { _ in true })
+    let key = try #require(PerformanceBaselines.key(for: test, testCase: testCase))
+
+    var policy = PerformanceBaselines.RegressionPolicy()
+    policy.minimumNanosecondIncrease = 0
+    policy.minimumRelativeIncrease = 0
+    let baselines = try roundTrip([-1, -1, -1], forKey: key, policy: policy)
+
+    await confirmation("Performance regression recorded") { regressionRecorded in
+      var configuration = Configuration()
+      configuration.performanceBaselines = baselines
+      configuration.eventHandler = { event, _ in
+        if case let .issueRecorded(issue) = event.kind, case .performanceRegressed = issue.kind {
+          regressionRecorded()
+        }
+      }
+      await test.run(configuration: configuration)
+    }
+  }
+#endif
+}
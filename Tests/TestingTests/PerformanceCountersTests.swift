@@ -0,0 +1,75 @@
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for Swift project authors
+//
+
+@testable @_spi(Experimental) @_spi(ForToolsIntegrationOnly) import Testing
+
+@Suite("Performance Counters Tests")
+struct PerformanceCountersTests {
+  @Test("Summary includes only available counters")
+  func summary() {
+    let softwareOnly = PerformanceCounters(taskClockNanoseconds: 1_500, pageFaults: 1)
+    #expect(softwareOnly.summary == "1.500 µs of CPU time, 1 page fault")
+
+    let all = PerformanceCounters(instructions: 1_000, cycles: 2_000, cacheMisses: 3, branchMisses: 1, taskClockNanoseconds: 12, pageFaults: 0)
+    #expect(all.summary == "1000 instructions, 2000 cycles, 3 cache misses, 1 branch miss, 12.000 ns of CPU time, 0 page faults")
+  }
+
+  @Test("Performance counters are not measured by default")
+  func notMeasuredByDefault() async {
+    await confirmation("Performance counters measured", expectedCount: 0) { performanceCountersMeasured in
+      var configuration = Configuration()
+      configuration.eventHandler = { event, _ in
+        if case .performanceCountersMeasured = event.kind {
+          performanceCountersMeasured()
+        }
+      }
+      await Test {}.run(configuration: configuration)
+    }
+  }
+
+  @Test("Measured performance counters are posted for each test case")
+  func measured() async {
+    let measurements = Locked<[(Test.Case.ID?, PerformanceCounters)]>(rawValue: [])
+    var configuration = Configuration()
+    configuration.measurePerformanceCounters = true
+    configuration.eventHandler = { event, _ in
+      if case let .performanceCountersMeasured(performanceCounters) = event.kind {
+        measurements.withLock { measurements in
+          measurements.append((event.testCaseID, performanceCounters))
+        }
+      }
+    }
+    await Test(arguments: 0 ..< 3) { _ in }.run(configuration: configuration)
+
+    // Performance counters may be unavailable (for instance, if the process is
+    // sandboxed), and test cases that resume on another thread are not
+    // reported, so only check the measurements that were posted.
+    let measurementValues = measurements.rawValue
+    #expect(measurementValues.count <= 3)
+    for (testCaseID, performanceCounters) in measurementValues {
+      #expect(testCaseID != nil)
+      #expect(!performanceCounters.summary.isEmpty)
+    }
+  }
+
+  @Test("Benchmarks are measured once per test case, not per iteration")
+  func measuredOncePerBenchmark() async {
+    await confirmation("Performance counters measured", expectedCount: 0 ... 1) { performanceCountersMeasured in
+      var configuration = Configuration()
+      configuration.measurePerformanceCounters = true
+      configuration.eventHandler = { event, _ in
+        if case .performanceCountersMeasured = event.kind {
+          performanceCountersMeasured()
+        }
+      }
+      await Test(.benchmark(iterations: 10, warmup: 0)) {}.run(configuration: configuration)
+    }
+  }
+}
@@ -0,0 +1,123 @@
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for Swift project authors
+//
+
+@testable @_spi(Experimental) @_spi(ForToolsIntegrationOnly) import Testing
+
+@Suite("Retry Policy Tests")
+struct RetryPolicyTests {
+  /// Run a test with a retry policy and collect the results of retrying it.
+  ///
+  /// - Parameters:
+  ///   - test: The test to run.
+  ///   - maximumRetryCount: The maximum number of times to retry each failed
+  ///     test case.
+  ///
+  /// - Returns: The results posted for each retried test case, in order.
+  private func _retryResults(running test: Test, maximumRetryCount: Int) async -> [Configuration.RetryPolicy.Result] {
+    let results = Locked<[Configuration.RetryPolicy.Result]>(rawValue: [])
+    var configuration = Configuration()
+    configuration.retryPolicy = Configuration.RetryPolicy(maximumRetryCount: maximumRetryCount)
+    configuration.eventHandler = { event, _ in
+      if case let .testCaseRetried(result) = event.kind {
+        #expect(event.testCaseID != nil)
+        results.withLock { results in
+          results.append(result)
+        }
+      }
+    }
+    await test.run(configuration: configuration)
+    return results.rawValue
+  }
+
+  @Test("Test case that passes when retried is flaky")
+  func flaky() async {
+    let attemptCount = Locked(rawValue: 0)
+    let results = await _retryResults(running: Test {
+      let attemptIndex = attemptCount.withLock { attemptCount in
+        defer {
+          attemptCount += 1
+        }
+        return attemptCount
+      }
+      #expect(attemptIndex >= 2)
+    }, maximumRetryCount: 5)
+
+    #expect(results.map(\.verdict) == [.flaky])
+    #expect(results.map(\.retryCount) == [2])
+    #expect(results.map(\.failureDescriptions.count) == [1])
+    #expect(attemptCount.rawValue == 3)
+  }
+
+  @Test("Test case that fails every retry is consistently failing")
+  func consistentlyFailing() async {
+    let attemptCount = Locked(rawValue: 0)
+    let results = await _retryResults(running: Test {
+      attemptCount.increment()
+      Issue.record()
+    }, maximumRetryCount: 3)
+
+    #expect(results.map(\.verdict) == [.consistentlyFailing])
+    #expect(results.map(\.retryCount) == [3])
+    #expect(results.map(\.failureDescriptions.count) == [3])
+    #expect(attemptCount.rawValue == 4)
+  }
+
+  @Test("Retries are only reported by the retry event")
+  func retriesOnlyReportedByRetryEvent() async {
+    let testCaseStartedCount = Locked(rawValue: 0)
+    let issueRecordedCount = Locked(rawValue: 0)
+    let testCaseRetriedCount = Locked(rawValue: 0)
+    let testEnded = Locked(rawValue: false)
+    var configuration = Configuration()
+    configuration.retryPolicy = Configuration.RetryPolicy(maximumRetryCount: 2)
+    configuration.eventHandler = { event, context in
+      switch event.kind {
+      case .testCaseStarted:
+        testCaseStartedCount.increment()
+      case .issueRecorded:
+        issueRecordedCount.increment()
+      case .testCaseRetried:
+        #expect(testEnded.rawValue)
+        testCaseRetriedCount.increment()
+      case .testEnded where context.test?.isSuite == false:
+        testEnded.withLock { testEnded in
+          testEnded = true
+        }
+      default:
+        break
+      }
+    }
+    await Test {
+      Issue.record()
+    }.run(configuration: configuration)
+
+    #expect(testCaseStartedCount.rawValue == 1)
+    #expect(issueRecordedCount.rawValue == 1)
+    #expect(testCaseRetriedCount.rawValue == 1)
+  }
+
+  @Test("Passing test cases are not retried")
+  func passingTestCases() async {
+    let attemptCount = Locked(rawValue: 0)
+    let results = await _retryResults(running: Test(arguments: 0 ..< 3) { _ in
+      attemptCount.increment()
+    }, maximumRetryCount: 3)
+
+    #expect(results.isEmpty)
+    #expect(attemptCount.rawValue == 3)
+  }
+
+  @Test("Result summary")
+  func summary() {
+    #expect(Configuration.RetryPolicy.Result(verdict: .flaky, retryCount: 2).summary == "is flaky: it passed on retry 2")
+    #expect(Configuration.RetryPolicy.Result(verdict: .consistentlyFailing, retryCount: 1).summary == "failed consistently: it failed again when retried")
+    #expect(Configuration.RetryPolicy.Result(verdict: .consistentlyFailing, retryCount: 3).summary == "failed consistently: it failed all 3 retries")
+  }
+}
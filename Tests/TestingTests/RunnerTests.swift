@@ -491,6 +491,43 @@ final class RunnerTests: XCTestCase {
     await fulfillment(of: [expectationCheckedAndPassed, expectationCheckedAndFailed], timeout: 0.0)
   }
 
+  func testExpectationCounting() async {
+    let testCaseEnded = expectation(description: "Test case ended")
+
+    var configuration = Configuration()
+    configuration.countExpectationsChecked = true
+    configuration.eventHandler = { event, _ in
+      if case .expectationChecked = event.kind {
+        XCTFail("Expectation checked event was posted unexpectedly")
+      }
+      guard case .testCaseEnded = event.kind else {
+        return
+      }
+      XCTAssertEqual(event.expectationCounts, Event.ExpectationCounts(passed: 3, failed: 1))
+      testCaseEnded.fulfill()
+    }
+
+    let runner = await Runner(testing: [
+      Test {
+        #expect(Bool(true))
+        await withTaskGroup(of: Void.self) { taskGroup in
+          taskGroup.addTask {
+            #expect(Bool(true))
+          }
+          taskGroup.addTask {
+            #expect(Bool(true))
+          }
+        }
+        withKnownIssue {
+          #expect(Bool(false))
+        }
+      },
+    ], configuration: configuration)
+    await runner.run()
+
+    await fulfillment(of: [testCaseEnded], timeout: 0.0)
+  }
+
   @Suite(.hidden) struct PoundIfTrueTest {
 #if true
     @Test(.hidden) func f() {}
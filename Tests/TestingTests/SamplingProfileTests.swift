@@ -0,0 +1,58 @@
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for Swift project authors
+//
+
+@testable @_spi(Experimental) @_spi(ForToolsIntegrationOnly) import Testing
+
+@Suite("Sampling Profile Tests")
+struct SamplingProfileTests {
+  @Test("Folded stacks")
+  func foldedStacks() {
+    let profile = SamplingProfile(
+      sampleCounts: [
+        Backtrace(addresses: [0x30, 0x20, 0x10] as [Backtrace.Address]): 3,
+        Backtrace(addresses: [0x20, 0x10] as [Backtrace.Address]): 2,
+      ],
+      droppedSampleCount: 0
+    )
+    let foldedStacks = profile.foldedStacks(under: "Module.test();x", symbolicationMode: .mangled)
+    #expect(foldedStacks == [
+      "Module.test(),x;0x10;0x20;0x30": 3,
+      "Module.test(),x;0x10;0x20": 2,
+    ])
+  }
+
+  @Test("Result summary")
+  func summary() {
+    var profile = SamplingProfile(sampleCounts: [Backtrace(addresses: [0x10] as [Backtrace.Address]): 5], droppedSampleCount: 0)
+    #expect(profile.summary == "5 samples of 1 call stack")
+    profile.droppedSampleCount = 2
+    #expect(profile.summary == "5 samples of 1 call stack (2 dropped)")
+  }
+
+#if os(Linux)
+  @Test("Test cases are profiled")
+  func testCasesAreProfiled() async {
+    let profiles = Locked<[SamplingProfile]>(rawValue: [])
+    var configuration = Configuration()
+    configuration.profileTestCases = true
+    configuration.isParallelizationEnabled = false
+    configuration.eventHandler = { event, _ in
+      if case let .testCaseProfiled(profile) = event.kind {
+        profiles.withLock { profiles in
+          profiles.append(profile)
+        }
+      }
+    }
+    await Test(arguments: 0 ..< 3) { _ in }.run(configuration: configuration)
+
+    #expect(profiles.rawValue.count == 3)
+  }
+#endif
+}
@@ -0,0 +1,63 @@
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for Swift project authors
+//
+
+@testable @_spi(Experimental) @_spi(ForToolsIntegrationOnly) import Testing
+
+@Suite("Startup Profile Tests")
+struct StartupProfileTests {
+  @Test("Time added to a phase accumulates")
+  func add() {
+    var startupProfile = StartupProfile()
+    startupProfile.add(1_000, to: .discovery)
+    startupProfile.add(500, to: .argumentParsing)
+    startupProfile.add(2_000, to: .discovery)
+
+    #expect(startupProfile.measurements.map(\.phase) == [.discovery, .argumentParsing])
+    #expect(startupProfile.measurements.map(\.nanoseconds) == [3_000, 500])
+  }
+
+  @Test("Plan construction phases are nested in the summary and total")
+  func summary() {
+    var startupProfile = StartupProfile()
+    startupProfile.add(1_000, to: .configuration)
+    startupProfile.add(100, to: .filtering)
+    startupProfile.add(200, to: .traitPreparation)
+    startupProfile.add(2_000, to: .planConstruction)
+
+    #expect(startupProfile.totalNanoseconds == 3_000)
+    #expect(startupProfile.summary == "configuration 1.000 µs, plan construction 2.000 µs (filtering 100.000 ns, trait preparation 200.000 ns)")
+  }
+
+  @Test("Constructing a runner plan measures each phase of planning")
+  func planConstruction() async {
+    let startupProfile = Locked(rawValue: StartupProfile())
+    let tests = [
+      Test {},
+      Test(arguments: 0 ..< 3) { _ in },
+    ]
+    _ = await Runner.Plan(tests: tests, configuration: .init(), startupProfile: startupProfile)
+
+    let phases = Set(startupProfile.rawValue.measurements.map(\.phase))
+    #expect(phases == [.planConstruction, .filtering, .traitPreparation, .testCaseEvaluation])
+  }
+
+  @Test("Startup is summarized only in verbose output")
+  func humanReadableOutput() {
+    var startupProfile = StartupProfile()
+    startupProfile.add(1_000, to: .discovery)
+    let event = Event(.startupMeasured(startupProfile), testID: nil, testCaseID: nil)
+    let context = Event.Context(test: nil, testCase: nil, configuration: nil)
+
+    let recorder = Event.HumanReadableOutputRecorder()
+    #expect(recorder.record(event, in: context, verbosity: 0).isEmpty)
+    let messages = recorder.record(event, in: context, verbosity: 1)
+    #expect(messages.map(\.stringValue) == ["Startup took 1.000 µs: discovery 1.000 µs."])
+  }
+}
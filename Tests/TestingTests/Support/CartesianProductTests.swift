@@ -114,4 +114,45 @@ struct CartesianProductTests {
     let product = cartesianProduct(0 ..< .max, 0 ..< .max)
     #expect(product.underestimatedCount == .max)
   }
+
+  @Test("Random access into a Cartesian product")
+  func randomAccess() {
+    let (c1, c2, product) = computeCartesianProduct()
+    #expect(product.count == c1.count * c2.count)
+    for _ in 0 ..< 100 {
+      let i1 = Int.random(in: c1.indices)
+      let i2 = Int.random(in: c2.indices)
+      let element = product[i1 * c2.count + i2]
+      #expect(element.0 == c1[i1])
+      #expect(element.1 == c2[i2])
+    }
+    let last = product[product.index(before: product.endIndex)]
+    #expect(last.0 == c1.last)
+    #expect(last.1 == c2.last)
+  }
+
+  @Test("Splitting a Cartesian product into chunks")
+  func chunks() {
+    let (_, _, product) = computeCartesianProduct()
+    let chunkSize = 7
+    let chunks = stride(from: product.startIndex, to: product.endIndex, by: chunkSize).map { start in
+      product[start ..< min(start + chunkSize, product.endIndex)]
+    }
+    #expect(chunks.map(\.count).reduce(0, +) == product.count)
+    #expect(chunks.flatMap { $0.map(\.1) } == Array(product).map(\.1))
+  }
+
+  @Test("Random access into a test case generator")
+  func randomAccessTestCaseGenerator() {
+    let generator = Test.Case.Generator(
+      arguments: 0 ..< 10, 10 ..< 20,
+      parameters: [
+        Test.Parameter(index: 0, firstName: "i", type: Int.self),
+        Test.Parameter(index: 1, firstName: "j", type: Int.self),
+      ]
+    ) { _, _ in }
+    #expect(generator.count == 100)
+    let testCase = generator[42]
+    #expect(testCase.arguments.map { $0.value as? Int } == [4, 12])
+  }
 }
@@ -0,0 +1,49 @@
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for Swift project authors
+//
+
+@testable import Testing
+
+@Suite("Collection Difference Description Tests")
+struct CollectionDifferenceTests {
+  @Test("Equal collections")
+  func equal() {
+    #expect([1, 2, 3].differenceDescription(from: [1, 2, 3]) == "")
+  }
+
+  @Test("Insertions and removals")
+  func insertionsAndRemovals() {
+    #expect([1, 2, 3, 4].differenceDescription(from: [1, 2, 4]) == "inserted [3]")
+    #expect([1, 2, 4].differenceDescription(from: [1, 2, 3, 4]) == "removed [3]")
+    #expect([1, 9, 4].differenceDescription(from: [1, 2, 4]) == "inserted [9], removed [2]")
+  }
+
+  @Test("Common prefix and suffix are trimmed from large collections")
+  func largeCollectionsWithSmallChange() {
+    var lhs = Array(0 ..< 1_000_000)
+    let rhs = lhs
+    lhs[500_000] = -1
+    #expect(lhs.differenceDescription(from: rhs) == "inserted [-1], removed [500000]")
+  }
+
+  @Test("Large, completely different collections are summarized")
+  func largeCollectionsWithLargeChange() {
+    let lhs = Array(0 ..< 100_000)
+    let rhs = Array(lhs.reversed())
+    let description = lhs.differenceDescription(from: rhs, maximumListedCount: 3)
+    #expect(description == "replaced 100000 elements starting at offset 0 with 100000 elements: inserted [0, 1, 2] (and 99997 more), removed [99999, 99998, 99997] (and 99997 more)")
+  }
+
+  @Test("Long lists of changes are truncated")
+  func truncation() {
+    let lhs = Array(0 ..< 10)
+    let description = lhs.differenceDescription(from: [], maximumListedCount: 3)
+    #expect(description == "inserted [0, 1, 2] (and 7 more)")
+  }
+}
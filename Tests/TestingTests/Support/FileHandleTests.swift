@@ -108,6 +108,21 @@ struct FileHandleTests {
     }
   }
 
+  @Test("Can read lines from a file")
+  func canReadLines() throws {
+    try withTemporaryPath { path in
+      do {
+        let fileHandle = try FileHandle(forWritingAtPath: path)
+        try fileHandle.write("abc\n\ndef")
+      }
+      let fileHandle = try FileHandle(forReadingAtPath: path)
+      #expect(try fileHandle.readLine() == Array("abc".utf8))
+      #expect(try fileHandle.readLine() == [])
+      #expect(try fileHandle.readLine() == Array("def".utf8))
+      #expect(try fileHandle.readLine() == nil)
+    }
+  }
+
   @Test("Cannot write bytes to a read-only file")
   func cannotWriteBytesToReadOnlyFile() throws {
     let fileHandle = try FileHandle.null(mode: "rb")
@@ -416,6 +416,71 @@ struct GraphTests {
     #expect(graph2.children["C3"]?.children["C4"]?.value == -2468)
   }
 
+  @Test("concurrentForEach(maxConcurrentChildren:_:) function", arguments: [1, 2, .max])
+  func concurrentForEach(maxConcurrentChildren: Int) async {
+    let graph = Graph<String, Int>(value: 123, children: [
+      "C1": Graph(value: 456),
+      "C2": Graph(value: 789, children: [
+        "C3": Graph(value: 2468),
+        "C4": Graph(value: 1357),
+      ]),
+    ])
+
+    let values = Locked<[[String]: Int]>()
+    await graph.concurrentForEach(maxConcurrentChildren: maxConcurrentChildren) { keyPath, value in
+      values.withLock { values in
+        values[keyPath] = value
+      }
+    }
+    #expect(values.rawValue == [[]: 123, ["C1"]: 456, ["C2"]: 789, ["C2", "C3"]: 2468, ["C2", "C4"]: 1357])
+  }
+
+  @Test("concurrentCompactMapValues(maxConcurrentChildren:_:) function", arguments: [1, 2, .max])
+  func concurrentCompactMapValues(maxConcurrentChildren: Int) async throws {
+    let graph = Graph<String, Int?>(value: 123, children: [
+      "C1": Graph(value: nil, children: [
+        "C2": Graph(value: 13579),
+      ]),
+      "C3": Graph(value: 789, children: [
+        "C4": Graph(value: nil),
+        "C5": Graph(value: 2468),
+      ]),
+    ])
+
+    let mappedGraph = await graph.concurrentCompactMapValues(maxConcurrentChildren: maxConcurrentChildren) { _, value in
+      value.map(-)
+    }
+    let graph2 = try #require(mappedGraph)
+    #expect(graph2.value == -123)
+    #expect(graph2.children["C1"] == nil)
+    #expect(graph2.children["C3"]?.value == -789)
+    #expect(graph2.children["C3"]?.children["C4"] == nil)
+    #expect(graph2.children["C3"]?.children["C5"]?.value == -2468)
+  }
+
+  @Test("concurrentMapValues(maxConcurrentChildren:_:) function (recursively applied)")
+  func concurrentMapValuesWithRecursiveApplication() async {
+    let graph = Graph<String, Int>(value: 123, children: [
+      "C1": Graph(value: 456, children: [
+        "C2": Graph(value: 13579),
+      ]),
+      "C3": Graph(value: 789, children: [
+        "C4": Graph(value: 2468),
+      ]),
+    ])
+
+    let graph2 = await graph.concurrentMapValues { _, value in
+      if value == 456 {
+        return (999, recursivelyApply: true)
+      }
+      return (-value, recursivelyApply: false)
+    }
+    #expect(graph2.value == -123)
+    #expect(graph2.children["C1"]?.value == 999)
+    #expect(graph2.children["C1"]?.children["C2"]?.value == 999)
+    #expect(graph2.children["C3"]?.children["C4"]?.value == -2468)
+  }
+
   @Test("mapValues(_:) function (recursively applied)")
   func mapValuesWithRecursiveApplication() throws {
     let graph = Graph<String, Int>(value: 123, children: [
@@ -22,4 +22,126 @@ struct LockTests {
     }
     #expect(value.rawValue == 1)
   }
+
+  @Test("Mutating a labeled value within withLock(_:)")
+  func labeledLocking() {
+    let value = Locked(rawValue: 0, label: "labeled lock")
+
+    value.withLock { value in
+      value += 1
+    }
+    #expect(value.rawValue == 1)
+  }
+
+  @Test("LockStatistics records uncontended and contended acquisitions")
+  func lockStatistics() {
+    let statistics = LockStatistics(label: "statistics")
+
+    var blocked = false
+    statistics.acquire(trying: { true }, orBlocking: { blocked = true })
+    #expect(!blocked)
+    #expect(statistics.acquisitionCount.rawValue == 1)
+    #expect(statistics.contendedAcquisitionCount.rawValue == 0)
+    #expect(statistics.waitNanoseconds.rawValue == 0)
+
+    statistics.acquire(trying: { false }, orBlocking: { blocked = true })
+    #expect(blocked)
+    #expect(statistics.acquisitionCount.rawValue == 2)
+    #expect(statistics.contendedAcquisitionCount.rawValue == 1)
+    #expect(statistics.waitNanoseconds.rawValue >= 0)
+  }
+
+  @Test("Adding to a Locked<Int> from many tasks")
+  func lockedCounterIsConsistentUnderContention() async {
+    let value = Locked(rawValue: 0)
+    await withTaskGroup(of: Void.self) { taskGroup in
+      for _ in 0 ..< 100 {
+        taskGroup.addTask {
+          for _ in 0 ..< 1_000 {
+            value.increment()
+          }
+        }
+      }
+    }
+    #expect(value.rawValue == 100_000)
+  }
+
+  @Test("Adding to and subtracting from an AtomicCounter")
+  func atomicCounter() {
+    let value = AtomicCounter(rawValue: 10)
+
+    #expect(value.rawValue == 10)
+    #expect(value.increment() == 11)
+    #expect(value.decrement() == 10)
+    #expect(value.add(5) == 15)
+    #expect(value.add(-20) == -5)
+    #expect(value.rawValue == -5)
+  }
+
+  @Test("Adding to an AtomicCounter from many tasks")
+  func atomicCounterIsConsistentUnderContention() async {
+    let value = AtomicCounter(rawValue: 0)
+    await withTaskGroup(of: Void.self) { taskGroup in
+      for _ in 0 ..< 100 {
+        taskGroup.addTask {
+          for _ in 0 ..< 1_000 {
+            value.increment()
+            value.add(2)
+            value.decrement()
+          }
+        }
+      }
+    }
+    #expect(value.rawValue == 200_000)
+  }
+
+  @available(_clockAPI, *)
+  @Test("Uncontended Locked<Int> and AtomicCounter run in reasonable time", .disabled("time-sensitive"))
+  func uncontendedCounting() {
+    let locked = Locked(rawValue: 0)
+    let lockedDuration = Test.Clock().measure {
+      for _ in 0 ..< 10_000_000 {
+        locked.increment()
+      }
+    }
+    let atomic = AtomicCounter(rawValue: 0)
+    let atomicDuration = Test.Clock().measure {
+      for _ in 0 ..< 10_000_000 {
+        atomic.increment()
+      }
+    }
+    #expect(lockedDuration < .seconds(1))
+    #expect(atomicDuration < lockedDuration)
+  }
+
+  @available(_clockAPI, *)
+  @Test("Contended Locked<Int> and AtomicCounter run in reasonable time", .disabled("time-sensitive"))
+  func contendedCounting() async {
+    let locked = Locked(rawValue: 0)
+    let lockedDuration = await Test.Clock().measure {
+      await withTaskGroup(of: Void.self) { taskGroup in
+        for _ in 0 ..< 8 {
+          taskGroup.addTask {
+            for _ in 0 ..< 1_000_000 {
+              locked.increment()
+            }
+          }
+        }
+      }
+    }
+    let atomic = AtomicCounter(rawValue: 0)
+    let atomicDuration = await Test.Clock().measure {
+      await withTaskGroup(of: Void.self) { taskGroup in
+        for _ in 0 ..< 8 {
+          taskGroup.addTask {
+            for _ in 0 ..< 1_000_000 {
+              atomic.increment()
+            }
+          }
+        }
+      }
+    }
+    #expect(lockedDuration < .seconds(5))
+    #expect(atomicDuration < lockedDuration)
+  }
 }
@@ -366,4 +366,82 @@ struct SwiftPMTests {
     let args = try parseCommandLineArguments(from: ["PATH", "--verbosity", "12345"])
     #expect(args.verbosity == 12345)
   }
+
+  @Test("--live-progress argument")
+  func liveProgress() throws {
+    var args = try parseCommandLineArguments(from: ["PATH"])
+    #expect(args.liveProgress == nil)
+    args = try parseCommandLineArguments(from: ["PATH", "--live-progress"])
+    #expect(args.liveProgress == true)
+  }
+
+  @Test("--performance-counters argument")
+  func performanceCounters() throws {
+    var configuration = try configurationForEntryPoint(withArguments: ["PATH"])
+    #expect(!configuration.measurePerformanceCounters)
+    configuration = try configurationForEntryPoint(withArguments: ["PATH", "--performance-counters"])
+    #expect(configuration.measurePerformanceCounters)
+    #expect(!configuration.isParallelizationEnabled)
+  }
+
+  @Test("--retry-failed argument")
+  func retryFailed() throws {
+    var configuration = try configurationForEntryPoint(withArguments: ["PATH"])
+    #expect(configuration.retryPolicy == nil)
+    configuration = try configurationForEntryPoint(withArguments: ["PATH", "--retry-failed", "3"])
+    var retryPolicy = try #require(configuration.retryPolicy)
+    #expect(retryPolicy.maximumRetryCount == 3)
+    #expect(!retryPolicy.retriesInNewProcess)
+
+    configuration = try configurationForEntryPoint(withArguments: ["PATH", "--retry-failed", "3", "--retry-failed-in-new-process"])
+    retryPolicy = try #require(configuration.retryPolicy)
+    #expect(retryPolicy.retriesInNewProcess)
+  }
+
+#if !SWT_NO_FILE_IO
+  @Test("--profile argument")
+  func profile() throws {
+    var configuration = try configurationForEntryPoint(withArguments: ["PATH"])
+    #expect(!configuration.profileTestCases)
+
+    let tempDirPath = try temporaryDirectory()
+    let temporaryFilePath = appendPathComponent("\(UInt64.random(in: 0 ..< .max))", to: tempDirPath)
+    defer {
+      _ = remove(temporaryFilePath)
+    }
+    configuration = try configurationForEntryPoint(withArguments: ["PATH", "--profile", temporaryFilePath])
+    #expect(configuration.profileTestCases)
+    #expect(!configuration.isParallelizationEnabled)
+  }
+#endif
+
+  @Test("--experimental-flake-hunt argument")
+  func flakeHunt() throws {
+    var configuration = try configurationForEntryPoint(withArguments: ["PATH"])
+    #expect(configuration.flakeHuntingPolicy == nil)
+    configuration = try configurationForEntryPoint(withArguments: ["PATH", "--experimental-flake-hunt", "500"])
+    var flakeHuntingPolicy = try #require(configuration.flakeHuntingPolicy)
+    #expect(flakeHuntingPolicy.maximumAttemptCount == 500)
+    #expect(flakeHuntingPolicy.stopsAtFirstFailure)
+    #expect(flakeHuntingPolicy.failureRateThreshold == nil)
+
+    configuration = try configurationForEntryPoint(withArguments: ["PATH", "--experimental-flake-hunt", "500", "--experimental-flake-hunt-threshold", "0.01"])
+    flakeHuntingPolicy = try #require(configuration.flakeHuntingPolicy)
+    #expect(!flakeHuntingPolicy.stopsAtFirstFailure)
+    #expect(flakeHuntingPolicy.failureRateThreshold == 0.01)
+
+    #expect(throws: (any Error).self) {
+      _ = try configurationForEntryPoint(withArguments: ["PATH", "--experimental-flake-hunt", "500", "--experimental-flake-hunt-threshold", "2"])
+    }
+  }
+
+#if !SWT_NO_FILE_IO
+  @Test("--experimental-server-socket-path argument")
+  func serverSocketPath() throws {
+    var args = try parseCommandLineArguments(from: ["PATH"])
+    #expect(args.serverSocketPath == nil)
+    args = try parseCommandLineArguments(from: ["PATH", "--experimental-server-socket-path", "/tmp/swt.sock"])
+    #expect(args.serverSocketPath == "/tmp/swt.sock")
+  }
+#endif
 }
@@ -72,6 +72,78 @@ struct Test_Case_Argument_IDTests {
     let argumentID = try #require(argument.id)
     #expect(String(decoding: argumentID.bytes, as: UTF8.self) == #""abc""#)
   }
+
+  @Test("One Codable parameter with a hashed ID")
+  func oneCodableParameterWithHashedID() async throws {
+    let test = Test(
+      arguments: [123],
+      parameters: [Test.Parameter(index: 0, firstName: "value", type: Int.self)]
+    ) { _ in }
+    let testCases = try #require(test.testCases)
+    let testCase = try #require(testCases.first { _ in true })
+    let argument = try #require(testCase.arguments.first)
+
+    var configuration = Configuration()
+    configuration.usesHumanReadableTestCaseArgumentIDs = false
+    let argumentID = try await Configuration.withCurrent(configuration) {
+      try #require(argument.id)
+    }
+    #expect(argumentID.bytes.count == 16)
+    #expect(argumentID == Test.Case.Argument.ID(bytes: try StableHashingEncoder.hash(of: 123)))
+  }
+
+  @Test("One CustomTestArgumentEncodable parameter with a hashed ID")
+  func oneCustomParameterWithHashedID() throws {
+    let parameter = Test.Parameter(index: 0, firstName: "value", type: MyCustomTestArgument.self)
+    let argumentID1 = try #require(try Test.Case.Argument.ID(identifying: MyCustomTestArgument(x: 123, y: "abc"), parameter: parameter, isHumanReadable: false))
+    let argumentID2 = try #require(try Test.Case.Argument.ID(identifying: MyCustomTestArgument(x: 123, y: "abc"), parameter: parameter, isHumanReadable: false))
+    let argumentID3 = try #require(try Test.Case.Argument.ID(identifying: MyCustomTestArgument(x: 456, y: "abc"), parameter: parameter, isHumanReadable: false))
+    #expect(argumentID1 == argumentID2)
+    #expect(argumentID1 != argumentID3)
+  }
+}
+
+@Suite("StableHashingEncoder Tests")
+struct StableHashingEncoderTests {
+  @Test("StableHasher matches the 128-bit FNV-1a test vector")
+  func fnv1a128() {
+    var hasher = StableHasher()
+    hasher.combine(UInt8(ascii: "a"))
+    #expect(hasher.bytes == [
+      0xD2, 0x28, 0xCB, 0x69, 0x6F, 0x1A, 0x8C, 0xAF,
+      0x78, 0x91, 0x2B, 0x70, 0x4E, 0x4A, 0x89, 0x64,
+    ])
+  }
+
+  @Test("Hashes depend on values and structure")
+  func distinctValues() throws {
+    #expect(try StableHashingEncoder.hash(of: 1) != StableHashingEncoder.hash(of: 2))
+    #expect(try StableHashingEncoder.hash(of: "1") != StableHashingEncoder.hash(of: 1))
+    #expect(try StableHashingEncoder.hash(of: ["a", "b"]) != StableHashingEncoder.hash(of: ["ab"]))
+    #expect(try StableHashingEncoder.hash(of: [[1], [2]]) != StableHashingEncoder.hash(of: [[1, 2]]))
+    #expect(try StableHashingEncoder.hash(of: Int?.none) != StableHashingEncoder.hash(of: 0))
+  }
+
+  @Test("Integer width does not affect hashes")
+  func integerWidths() throws {
+    #expect(try StableHashingEncoder.hash(of: 42 as Int8) == StableHashingEncoder.hash(of: 42 as Int))
+    #expect(try StableHashingEncoder.hash(of: 42 as UInt16) == StableHashingEncoder.hash(of: 42 as UInt))
+  }
+
+  @Test("Keyed values are hashed independently of their order")
+  func keyOrder() throws {
+    var dictionary1 = [String: Int]()
+    var dictionary2 = [String: Int]()
+    for i in 0 ..< 100 {
+      dictionary1["\(i)"] = i
+    }
+    for i in (0 ..< 100).reversed() {
+      dictionary2["\(i)"] = i
+    }
+    #expect(try StableHashingEncoder.hash(of: dictionary1) == StableHashingEncoder.hash(of: dictionary2))
+    dictionary2["0"] = 1
+    #expect(try StableHashingEncoder.hash(of: dictionary1) != StableHashingEncoder.hash(of: dictionary2))
+  }
 }
 
 // MARK: - Fixture parameter types
@@ -0,0 +1,90 @@
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for Swift project authors
+//
+
+#if canImport(Foundation) && !SWT_NO_FILE_IO && (SWT_TARGET_OS_APPLE || os(Linux) || os(FreeBSD) || os(Android))
+@testable @_spi(Experimental) @_spi(ForToolsIntegrationOnly) import Testing
+private import _TestingInternals
+
+@Suite("Test Server Tests")
+struct TestServerTests {
+  /// Connect to a test server, retrying until it is listening.
+  ///
+  /// - Parameters:
+  ///   - socketPath: The path at which the server is listening.
+  ///
+  /// - Returns: A file descriptor for the connection.
+  ///
+  /// - Throws: Any error that prevented connecting to the server.
+  private func _connect(to socketPath: String) async throws -> CInt {
+    for _ in 0 ..< 100 {
+      let fd = swt_unixDomainSocketConnect(socketPath)
+      if fd != -1 {
+        return fd
+      }
+      try await Task.sleep(nanoseconds: 50_000_000)
+    }
+    throw CError(rawValue: swt_errno())
+  }
+
+  @Test("Requests are served over a Unix domain socket")
+  func requestsAreServed() async throws {
+    let runCount = Locked(rawValue: 0)
+    let test = Test {
+      runCount.increment()
+    }
+
+    let tempDirPath = try temporaryDirectory()
+    let socketPath = appendPathComponent("\(UInt64.random(in: 0 ..< .max))", to: tempDirPath)
+    let server = Task {
+      try await serveTests([test], listeningAt: socketPath, connectionCount: 1)
+    }
+
+    let connectionFD = try await _connect(to: socketPath)
+    do {
+      let output = try FileHandle(unsafePOSIXFileDescriptor: connectionFD, mode: "wb")
+      let input = try FileHandle(unsafePOSIXFileDescriptor: dup(connectionFD), mode: "rb")
+
+      var request = __CommandLineArguments_v0()
+      request.eventStreamVersion = 0
+      request.verbosity = .min
+
+      // Send two requests over the same connection so that the second one is
+      // served using the cached runner plan.
+      for _ in 0 ..< 2 {
+        try JSON.withEncoding(of: request) { requestJSON in
+          try output.write(requestJSON)
+        }
+        try output.write("\n")
+
+        var eventKinds = [ABIv0.EncodedEvent.Kind]()
+        while let recordJSON = try input.readLine() {
+          let record = try recordJSON.withUnsafeBytes { recordJSON in
+            try JSON.decode(ABIv0.Record.self, from: recordJSON)
+          }
+          if case let .event(event) = record.kind {
+            eventKinds.append(event.kind)
+            if event.kind == .runEnded {
+              break
+            }
+          }
+        }
+        #expect(eventKinds.first == .runStarted)
+        #expect(eventKinds.contains(.testStarted))
+        #expect(eventKinds.contains(.testEnded))
+        #expect(eventKinds.last == .runEnded)
+      }
+    }
+
+    // Closing the connection ends the server's only session.
+    try await server.value
+    #expect(runCount.rawValue == 2)
+  }
+}
+#endif
@@ -0,0 +1,109 @@
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for Swift project authors
+//
+
+@testable @_spi(Experimental) @_spi(ForToolsIntegrationOnly) import Testing
+
+@Suite("Allocation Budget Trait Tests", .tags(.traitRelated))
+struct AllocationBudgetTraitTests {
+  @Test("Budgets are exceeded by too many allocations or bytes")
+  func isExceeded() {
+    let allocationCounts = Event.AllocationCounts(allocationCount: 10, deallocationCount: 4, allocatedByteCount: 1024, deallocatedByteCount: 256)
+    #expect(allocationCounts.outstandingByteCount == 768)
+
+    #expect(!AllocationBudgetTrait.allocationBudget().isExceeded(by: allocationCounts))
+    #expect(!AllocationBudgetTrait.allocationBudget(allocations: 10, bytes: 1024).isExceeded(by: allocationCounts))
+    #expect(AllocationBudgetTrait.allocationBudget(allocations: 9).isExceeded(by: allocationCounts))
+    #expect(AllocationBudgetTrait.allocationBudget(bytes: 1023).isExceeded(by: allocationCounts))
+  }
+
+  @Test("Issue description includes the budget")
+  func issueDescription() {
+    let allocationCounts = Event.AllocationCounts(allocationCount: 3, allocatedByteCount: 96)
+    let kind = Issue.Kind.allocationBudgetExceeded(allocationCounts, budget: .allocationBudget(allocations: 1, bytes: 64))
+    #expect(String(describing: kind) == "Allocation budget was exceeded: made 3 allocations totaling 96 bytes, but the budget allows at most 1 allocation and 64 bytes")
+  }
+
+  @Test("Test cases are not tracked by default")
+  func notTrackedByDefault() async {
+    await confirmation("Test case ended") { testCaseEnded in
+      var configuration = Configuration()
+      configuration.eventHandler = { event, _ in
+        if case .testCaseEnded = event.kind {
+          #expect(event.allocationCounts == nil)
+          testCaseEnded()
+        }
+      }
+      await Test {}.run(configuration: configuration)
+    }
+  }
+
+  @Test("Allocations are attached to testCaseEnded events", .enabled(if: Event.AllocationCounts.isTrackingAvailable))
+  func trackAllocations() async {
+    await confirmation("Test case ended") { testCaseEnded in
+      var configuration = Configuration()
+      configuration.trackAllocations = true
+      configuration.eventHandler = { event, _ in
+        if case .testCaseEnded = event.kind, let allocationCounts = event.allocationCounts {
+          #expect(allocationCounts.allocationCount >= 1)
+          #expect(allocationCounts.allocatedByteCount >= 1024 * MemoryLayout<Int>.stride)
+          testCaseEnded()
+        }
+      }
+      await Test {
+        let array = [Int](repeating: 0, count: 1024)
+        withExtendedLifetime(array) {}
+      }.run(configuration: configuration)
+    }
+  }
+
+  @Test("Exceeding an allocation budget records an issue", .enabled(if: Event.AllocationCounts.isTrackingAvailable))
+  func budgetExceeded() async {
+    await confirmation("Allocation budget exceeded") { budgetExceeded in
+      var configuration = Configuration()
+      configuration.eventHandler = { event, _ in
+        if case let .issueRecorded(issue) = event.kind, case .allocationBudgetExceeded = issue.kind {
+          budgetExceeded()
+        }
+      }
+      await Test(.allocationBudget(bytes: 64)) {
+        let array = [Int](repeating: 0, count: 1024)
+        withExtendedLifetime(array) {}
+      }.run(configuration: configuration)
+    }
+  }
+
+  @Test("An allocation budget that cannot be checked records a known issue", .disabled(if: Event.AllocationCounts.isTrackingAvailable))
+  func budgetUnchecked() async {
+    await confirmation("Allocation budget not checked") { budgetUnchecked in
+      var configuration = Configuration()
+      configuration.eventHandler = { event, _ in
+        if case let .issueRecorded(issue) = event.kind {
+          #expect(issue.isKnown)
+          budgetUnchecked()
+        }
+      }
+      await Test(.allocationBudget(bytes: 64)) {}.run(configuration: configuration)
+    }
+  }
+
+  @Test("Only the allocation budget's test is tracked")
+  func allocationBudget() {
+    let budgetedTest = Test(.allocationBudget(allocations: 0)) {}
+    let unbudgetedTest = Test {}
+    #expect(budgetedTest.allocationBudget?.maximumAllocationCount == 0)
+    #expect(unbudgetedTest.allocationBudget == nil)
+  }
+
+  @Test("Test cases with an allocation budget run in isolation")
+  func isIsolated() {
+    #expect(Test(.allocationBudget(allocations: 0)) {}.isIsolated)
+    #expect(!Test {}.isIsolated)
+  }
+}
@@ -0,0 +1,176 @@
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for Swift project authors
+//
+
+@testable @_spi(Experimental) @_spi(ForToolsIntegrationOnly) import Testing
+
+@Suite("Benchmark Trait Tests", .tags(.traitRelated))
+struct BenchmarkTraitTests {
+  @Test("Statistics are computed correctly")
+  func statistics() {
+    let statistics = BenchmarkTrait.Statistics(durations: (1 ... 100).reversed().map(Int64.init))
+    #expect(statistics.iterationCount == 100)
+    #expect(statistics.minimumNanoseconds == 1)
+    #expect(statistics.maximumNanoseconds == 100)
+    #expect(statistics.medianNanoseconds == 50)
+    #expect(statistics.p99Nanoseconds == 99)
+    #expect(statistics.meanNanoseconds == 50.5)
+    #expect(abs(statistics.standardDeviationNanoseconds - 29.011) < 0.001)
+  }
+
+  @Test("Statistics for a single iteration")
+  func singleIterationStatistics() {
+    let statistics = BenchmarkTrait.Statistics(durations: [42])
+    #expect(statistics.minimumNanoseconds == 42)
+    #expect(statistics.medianNanoseconds == 42)
+    #expect(statistics.p99Nanoseconds == 42)
+    #expect(statistics.standardDeviationNanoseconds == 0)
+  }
+
+  @Test("Nanoseconds are described in the appropriate unit", arguments: [
+    (12.0, "12.000 ns"),
+    (1_500.0, "1.500 µs"),
+    (2_250_000.0, "2.250 ms"),
+    (3_000_000_000.0, "3.000 s"),
+  ])
+  func descriptionOfNanoseconds(nanoseconds: Double, expectedDescription: String) {
+    #expect(BenchmarkTrait.Statistics.descriptionOfNanoseconds(nanoseconds) == expectedDescription)
+  }
+
+  @Test("Benchmarked tests run warmup and measured iterations")
+  func iterations() async {
+    let callCount = AtomicCounter(rawValue: 0)
+    let statistics = Locked<[BenchmarkTrait.Statistics]>(rawValue: [])
+    var configuration = Configuration()
+    configuration.eventHandler = { event, _ in
+      if case let .benchmarkEnded(eventStatistics) = event.kind {
+        statistics.withLock { statistics in
+          statistics.append(eventStatistics)
+        }
+      }
+    }
+
+    await Test(.benchmark(iterations: 5, warmup: 2)) {
+      callCount.increment()
+    }.run(configuration: configuration)
+
+    #expect(callCount.rawValue == 7)
+    #expect(statistics.rawValue.count == 1)
+    #expect(statistics.rawValue.first?.iterationCount == 5)
+  }
+
+  @Test("A failing iteration stops the benchmark")
+  func failingIteration() async {
+    let callCount = AtomicCounter(rawValue: 0)
+    await confirmation("Issue recorded") { issueRecorded in
+      await confirmation("Benchmark ended", expectedCount: 0) { benchmarkEnded in
+        var configuration = Configuration()
+        configuration.eventHandler = { event, _ in
+          switch event.kind {
+          case .issueRecorded:
+            issueRecorded()
+          case .benchmarkEnded:
+            benchmarkEnded()
+          default:
+            break
+          }
+        }
+
+        await Test(.benchmark(iterations: 100, warmup: 2)) {
+          callCount.increment()
+          #expect(callCount.rawValue > 3)
+        }.run(configuration: configuration)
+      }
+    }
+    #expect(callCount.rawValue == 1)
+  }
+
+  @Test("Each test case of a parameterized test is benchmarked")
+  func parameterized() async {
+    await confirmation("Benchmark ended", expectedCount: 3) { benchmarkEnded in
+      var configuration = Configuration()
+      configuration.eventHandler = { event, _ in
+        if case .benchmarkEnded = event.kind {
+          benchmarkEnded()
+        }
+      }
+      await Test(.benchmark(iterations: 2, warmup: 0), arguments: 0 ..< 3) { _ in }.run(configuration: configuration)
+    }
+  }
+
+  @Test("Benchmark results are included in human-readable output")
+  func humanReadableOutput() async {
+    let recorder = Event.HumanReadableOutputRecorder()
+    let messages = Locked<[String]>(rawValue: [])
+    var configuration = Configuration()
+    configuration.eventHandler = { event, context in
+      if case .benchmarkEnded = event.kind {
+        let eventMessages = recorder.record(event, in: context)
+        messages.withLock { messages in
+          messages += eventMessages.map(\.stringValue)
+        }
+      }
+    }
+
+    await Test(.benchmark(iterations: 3, warmup: 0)) {}.run(configuration: configuration)
+
+    #expect(messages.rawValue.count == 1)
+    #expect(messages.rawValue.first?.contains("benchmarked: min ") == true)
+    #expect(messages.rawValue.first?.contains("over 3 iterations") == true)
+  }
+
+  @Test("Isolated test cases do not overlap with other test cases")
+  func isolationGate() async {
+    struct State {
+      var sharedCount = 0
+      var isHeldExclusively = false
+      var violationCount = 0
+    }
+    let gate = Runner.IsolationGate()
+    let state = Locked(rawValue: State())
+
+    await withTaskGroup(of: Void.self) { taskGroup in
+      for i in 0 ..< 100 {
+        let isExclusive = i % 10 == 0
+        taskGroup.addTask {
+          await gate.withAccess(exclusive: isExclusive) {
+            state.withLock { state in
+              if state.isHeldExclusively || (isExclusive && state.sharedCount > 0) {
+                state.violationCount += 1
+              }
+              if isExclusive {
+                state.isHeldExclusively = true
+              } else {
+                state.sharedCount += 1
+              }
+            }
+            await Task.yield()
+            state.withLock { state in
+              if isExclusive {
+                state.isHeldExclusively = false
+              } else {
+                state.sharedCount -= 1
+              }
+            }
+          }
+        }
+      }
+    }
+
+    #expect(state.rawValue.violationCount == 0)
+  }
+
+  @Test("Only isolated benchmarks require isolation")
+  func isIsolated() {
+    let isolatedTest = Test(.benchmark(iterations: 1, warmup: 0)) {}
+    let unisolatedTest = Test(.benchmark(iterations: 1, warmup: 0, isolated: false)) {}
+    #expect(isolatedTest.isIsolated)
+    #expect(!unisolatedTest.isIsolated)
+  }
+}
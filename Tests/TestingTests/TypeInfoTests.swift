@@ -50,6 +50,20 @@ struct TypeInfoTests {
     #expect(TypeInfo(describing: T.self).fullyQualifiedName == "(Swift.Int, Swift.String) -> Swift.Bool")
   }
 
+  @Test func fullyQualifiedNameIsStableWhenReadConcurrently() async {
+    let typeInfos = ([String.self, String.NestedType.self, SomeEnum.self, Int.self, [Int].self] as [Any.Type]).map { TypeInfo(describing: $0) }
+    let expectedNames = [
+      "Swift.String", "Swift.String.NestedType", "TestingTests.SomeEnum", "Swift.Int", "Swift.Array<Swift.Int>",
+    ]
+    await withTaskGroup(of: Void.self) { taskGroup in
+      for _ in 0 ..< 100 {
+        taskGroup.addTask {
+          #expect(typeInfos.map(\.fullyQualifiedName) == expectedNames)
+        }
+      }
+    }
+  }
+
   @available(_mangledTypeNameAPI, *)
   @Test func mangledTypeName() {
     #expect(_mangledTypeName(String.self) == TypeInfo(describing: String.self).mangledName)